@@ -0,0 +1,318 @@
+/**
+ * Binary Indexed Tree (Fenwick Tree) in C++
+ * 
+ * Time Complexity:
+ * - Build: O(n)
+ * - Update / Prefix sum / lowerBound: O(log n)
+ * 
+ * Space Complexity: O(n)
+ * 
+ * Shared by BinaryIndexedTree.cpp, Heap.h (order-statistic window) and the
+ * bench/ suite.
+ */
+
+#ifndef DSA_BINARY_INDEXED_TREE_H
+#define DSA_BINARY_INDEXED_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "ThreadPool.h"
+
+template<typename T = int>
+class BinaryIndexedTree {
+private:
+    std::vector<T> tree;
+    int n;
+    int highBit;  // Largest power of two <= n, where lowerBound starts
+
+    static int highestPowerOfTwo(int n) {
+        int p = 1;
+        while (p * 2 <= n) p *= 2;
+        return n > 0 ? p : 0;
+    }
+
+public:
+    BinaryIndexedTree(int n) : tree(n + 1, T()), n(n), highBit(highestPowerOfTwo(n)) {}
+    
+    // O(n) construction
+    BinaryIndexedTree(const std::vector<T>& nums)
+        : tree(nums.size() + 1, T()), n(nums.size()), highBit(highestPowerOfTwo(nums.size())) {
+        for (int i = 0; i < n; i++) {
+            tree[i + 1] = nums[i];
+        }
+        for (int i = 1; i <= n; i++) {
+            int parent = i + (i & (-i));
+            if (parent <= n) {
+                tree[parent] += tree[i];
+            }
+        }
+    }
+    
+    int size() const { return n; }
+    
+    // Add delta to index i (0-indexed)
+    void update(int i, T delta) {
+        i++;
+        while (i <= n) {
+            tree[i] += delta;
+            i += i & (-i);
+        }
+    }
+    
+    // Prefix sum [0, i] (0-indexed)
+    T prefixSum(int i) const {
+        T sum = T();
+        i++;
+        while (i > 0) {
+            sum += tree[i];
+            i -= i & (-i);
+        }
+        return sum;
+    }
+    
+    // Range sum [l, r] (0-indexed, inclusive)
+    T rangeSum(int l, int r) const {
+        return prefixSum(r) - (l > 0 ? prefixSum(l - 1) : T());
+    }
+    
+    // Smallest i with prefixSum(i) >= target, or n if none. Requires
+    // non-negative values; descends the implicit tree in O(log n).
+    int lowerBound(T target) const {
+        int pos = 0;
+        for (int step = highBit; step > 0; step >>= 1) {
+            if (pos + step <= n && tree[pos + step] < target) {
+                pos += step;
+                target -= tree[pos];
+            }
+        }
+        return pos;  // 1-indexed answer is pos + 1
+    }
+};
+
+// ==================== 2D BIT ====================
+// Flat (rows + 1) x (cols + 1) array; row i starts at i * stride
+template<typename T = int>
+class BinaryIndexedTree2D {
+private:
+    std::vector<T> tree;
+    int rows, cols, stride;
+
+public:
+    BinaryIndexedTree2D(int rows, int cols) 
+        : tree((size_t)(rows + 1) * (cols + 1), T()), rows(rows), cols(cols), stride(cols + 1) {}
+    
+    void update(int row, int col, T delta) {
+        row++; col++;
+        for (int i = row; i <= rows; i += i & (-i)) {
+            T* line = tree.data() + (size_t)i * stride;
+            for (int j = col; j <= cols; j += j & (-j)) {
+                line[j] += delta;
+            }
+        }
+    }
+    
+    T prefixSum(int row, int col) const {
+        T sum = T();
+        row++; col++;
+        for (int i = row; i > 0; i -= i & (-i)) {
+            const T* line = tree.data() + (size_t)i * stride;
+            for (int j = col; j > 0; j -= j & (-j)) {
+                sum += line[j];
+            }
+        }
+        return sum;
+    }
+    
+    T rangeSum(int row1, int col1, int row2, int col2) const {
+        return prefixSum(row2, col2)
+             - prefixSum(row1 - 1, col2)
+             - prefixSum(row2, col1 - 1)
+             + prefixSum(row1 - 1, col1 - 1);
+    }
+};
+
+// ==================== Range Update BIT ====================
+// Point values are prefix sums of a difference array
+template<typename T = long long>
+class RangeUpdateBIT {
+private:
+    BinaryIndexedTree<T> diff;
+
+public:
+    RangeUpdateBIT(int n) : diff(n + 1) {}
+    
+    // Add delta to range [l, r]
+    void rangeAdd(int l, int r, T delta) {
+        diff.update(l, delta);
+        diff.update(r + 1, -delta);
+    }
+    
+    // Get value at index i
+    T get(int i) const {
+        return diff.prefixSum(i);
+    }
+};
+
+// ==================== Range Update Range Query BIT ====================
+template<typename T = long long>
+class RangeUpdateRangeQueryBIT {
+private:
+    BinaryIndexedTree<T> tree1, tree2;
+    
+    T prefixSum(int i) const {
+        return tree1.prefixSum(i) * i - tree2.prefixSum(i);
+    }
+
+public:
+    RangeUpdateRangeQueryBIT(int n) : tree1(n + 1), tree2(n + 1) {}
+    
+    void rangeAdd(int l, int r, T delta) {
+        tree1.update(l, delta);
+        tree1.update(r + 1, -delta);
+        tree2.update(l, delta * (l - 1));
+        tree2.update(r + 1, -delta * r);
+    }
+    
+    T rangeSum(int l, int r) const {
+        return prefixSum(r) - (l > 0 ? prefixSum(l - 1) : T());
+    }
+};
+
+// ==================== Concurrent BIT ====================
+// Lock-free multi-writer counters: update is a relaxed fetch_add per cell.
+// prefixSum is not a snapshot; it sees each concurrent update either
+// fully or not at all in every cell it reads, which is fine for monitoring.
+template<typename T = long long>
+class AtomicBinaryIndexedTree {
+    static_assert(std::is_integral<T>::value, "fetch_add needs an integral type");
+
+private:
+    std::unique_ptr<std::atomic<T>[]> tree;
+    int n;
+    int highBit;  // Largest power of two <= max(n, 1)
+
+public:
+    AtomicBinaryIndexedTree(int n) : tree(new std::atomic<T>[n + 1]), n(n), highBit(1) {
+        while (highBit * 2 <= n) highBit *= 2;
+        for (int i = 0; i <= n; i++) tree[i].store(0, std::memory_order_relaxed);
+    }
+    
+    int size() const { return n; }
+    
+    void update(int i, T delta) {
+        for (i++; i <= n; i += i & (-i)) {
+            tree[i].fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+    
+    T prefixSum(int i) const {
+        T sum = 0;
+        for (i++; i > 0; i -= i & (-i)) {
+            sum += tree[i].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+    
+    T rangeSum(int l, int r) const {
+        return prefixSum(r) - (l > 0 ? prefixSum(l - 1) : 0);
+    }
+    
+    // Same descent as BinaryIndexedTree::lowerBound, over relaxed loads
+    int lowerBound(T target) const {
+        int pos = 0;
+        for (int step = highBit; step > 0; step >>= 1) {
+            if (pos + step > n) continue;
+            T cell = tree[pos + step].load(std::memory_order_relaxed);
+            if (cell < target) {
+                pos += step;
+                target -= cell;
+            }
+        }
+        return pos;
+    }
+};
+
+// ==================== Sharded BIT ====================
+// One BIT per writer so updates never share cache lines. Each shard has a
+// single writer (e.g. the ThreadPool worker index), so an update is a plain
+// relaxed load + store with no locked instruction; reads sum every shard
+// in O(shards * log n).
+template<typename T = long long>
+class ShardedBinaryIndexedTree {
+    static_assert(std::is_integral<T>::value, "cells are std::atomic<T>");
+
+private:
+    struct alignas(64) Shard {
+        std::unique_ptr<std::atomic<T>[]> tree;
+    };
+    
+    std::vector<Shard> shards;
+    int n;
+
+public:
+    ShardedBinaryIndexedTree(int n, unsigned shardCount) : shards(std::max(shardCount, 1u)), n(n) {
+        for (Shard& shard : shards) {
+            shard.tree.reset(new std::atomic<T>[n + 1]);
+            for (int i = 0; i <= n; i++) shard.tree[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    
+    int size() const { return n; }
+    unsigned shardCount() const { return shards.size(); }
+    
+    // Only the owner of `shard` may call this
+    void update(unsigned shard, int i, T delta) {
+        std::atomic<T>* tree = shards[shard].tree.get();
+        for (i++; i <= n; i += i & (-i)) {
+            tree[i].store(tree[i].load(std::memory_order_relaxed) + delta,
+                          std::memory_order_relaxed);
+        }
+    }
+    
+    T prefixSum(int i) const {
+        T sum = 0;
+        for (const Shard& shard : shards) {
+            for (int j = i + 1; j > 0; j -= j & (-j)) {
+                sum += shard.tree[j].load(std::memory_order_relaxed);
+            }
+        }
+        return sum;
+    }
+    
+    T rangeSum(int l, int r) const {
+        return prefixSum(r) - (l > 0 ? prefixSum(l - 1) : 0);
+    }
+};
+
+// Count of Smaller Numbers After Self using BIT
+inline std::vector<int> countSmaller(std::vector<int>& nums) {
+    int n = nums.size();
+    std::vector<int> result(n);
+    
+    // Coordinate compression
+    std::vector<int> sorted = nums;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    
+    std::unordered_map<int, int> ranks;
+    for (int i = 0; i < sorted.size(); i++) {
+        ranks[sorted[i]] = i;
+    }
+    
+    BinaryIndexedTree<> bit(sorted.size());
+    
+    for (int i = n - 1; i >= 0; i--) {
+        int rank = ranks[nums[i]];
+        result[i] = rank > 0 ? bit.prefixSum(rank - 1) : 0;
+        bit.update(rank, 1);
+    }
+    
+    return result;
+}
+
+#endif  // DSA_BINARY_INDEXED_TREE_H
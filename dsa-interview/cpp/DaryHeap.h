@@ -0,0 +1,215 @@
+/**
+ * D-ary Heap Implementations in C++
+ * 
+ * Time Complexity:
+ * - Push / DecreaseKey: O(log_D n)
+ * - Pop: O(D log_D n)
+ * 
+ * Space Complexity: O(n)
+ * 
+ * Shared by Heap.h and Graph.h (Dijkstra queue policy).
+ */
+
+#ifndef DSA_DARY_HEAP_H
+#define DSA_DARY_HEAP_H
+
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+// ==================== D-ary Heap ====================
+// Wider nodes make the tree shallower (log_D n levels) and keep a node's D
+// children contiguous, so each level of siftDown scans one run of memory.
+// Sifting moves a "hole" instead of swapping: one move per level plus a
+// final placement, rather than three per swap.
+template<typename T, int D = 4, typename Compare = std::less<T>>
+class DaryHeap {
+    static_assert(D >= 2, "DaryHeap needs at least two children per node");
+
+private:
+    std::vector<T> heap;
+    Compare comp;
+    
+    static size_t parent(size_t i) { return (i - 1) / D; }
+    static size_t firstChild(size_t i) { return D * i + 1; }
+    
+    void siftUp(size_t i) {
+        T val = std::move(heap[i]);
+        while (i > 0) {
+            size_t p = parent(i);
+            if (!comp(val, heap[p])) break;
+            heap[i] = std::move(heap[p]);
+            i = p;
+        }
+        heap[i] = std::move(val);
+    }
+    
+    void siftDown(size_t i) {
+        const size_t n = heap.size();
+        T val = std::move(heap[i]);
+        while (true) {
+            size_t first = firstChild(i);
+            if (first >= n) break;
+            
+            size_t last = std::min(first + D, n);
+            size_t best = first;
+            for (size_t c = first + 1; c < last; c++) {
+                if (comp(heap[c], heap[best])) best = c;
+            }
+            if (!comp(heap[best], val)) break;
+            
+            heap[i] = std::move(heap[best]);
+            i = best;
+        }
+        heap[i] = std::move(val);
+    }
+
+public:
+    explicit DaryHeap(const Compare& comp = Compare()) : comp(comp) {}
+    
+    void push(const T& val) {
+        heap.push_back(val);
+        siftUp(heap.size() - 1);
+    }
+    
+    void push(T&& val) {
+        heap.push_back(std::move(val));
+        siftUp(heap.size() - 1);
+    }
+    
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        heap.emplace_back(std::forward<Args>(args)...);
+        siftUp(heap.size() - 1);
+    }
+    
+    const T& top() const {
+        return heap[0];
+    }
+    
+    void pop() {
+        heap[0] = std::move(heap.back());
+        heap.pop_back();
+        if (!heap.empty()) siftDown(0);
+    }
+    
+    void reserve(size_t n) { heap.reserve(n); }
+    void clear() { heap.clear(); }
+    int size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+};
+
+// ==================== Indexed D-ary Heap (decrease-key) ====================
+// Items are identified by an id in [0, capacity) and each id's heap position
+// is tracked, so a priority can be lowered in place. Dijkstra can then keep
+// one entry per vertex instead of pushing duplicates and skipping stale ones.
+template<typename Priority, int D = 4, typename Compare = std::less<Priority>>
+class IndexedDaryHeap {
+    static_assert(D >= 2, "IndexedDaryHeap needs at least two children per node");
+
+private:
+    struct Node {
+        Priority priority;
+        int id;
+    };
+    
+    std::vector<Node> heap;
+    std::vector<int> pos;  // id -> index in heap, -1 if absent
+    Compare comp;
+    
+    static size_t parent(size_t i) { return (i - 1) / D; }
+    static size_t firstChild(size_t i) { return D * i + 1; }
+    
+    void place(size_t i, Node&& node) {
+        pos[node.id] = static_cast<int>(i);
+        heap[i] = std::move(node);
+    }
+    
+    void siftUp(size_t i) {
+        Node node = std::move(heap[i]);
+        while (i > 0) {
+            size_t p = parent(i);
+            if (!comp(node.priority, heap[p].priority)) break;
+            place(i, std::move(heap[p]));
+            i = p;
+        }
+        place(i, std::move(node));
+    }
+    
+    void siftDown(size_t i) {
+        const size_t n = heap.size();
+        Node node = std::move(heap[i]);
+        while (true) {
+            size_t first = firstChild(i);
+            if (first >= n) break;
+            
+            size_t last = std::min(first + D, n);
+            size_t best = first;
+            for (size_t c = first + 1; c < last; c++) {
+                if (comp(heap[c].priority, heap[best].priority)) best = c;
+            }
+            if (!comp(heap[best].priority, node.priority)) break;
+            
+            place(i, std::move(heap[best]));
+            i = best;
+        }
+        place(i, std::move(node));
+    }
+
+public:
+    explicit IndexedDaryHeap(int capacity, const Compare& comp = Compare())
+        : pos(capacity, -1), comp(comp) {
+        heap.reserve(capacity);
+    }
+    
+    bool contains(int id) const { return pos[id] != -1; }
+    
+    const Priority& priorityOf(int id) const { return heap[pos[id]].priority; }
+    
+    // id must not already be in the heap
+    void push(int id, Priority priority) {
+        heap.push_back({std::move(priority), id});
+        siftUp(heap.size() - 1);
+    }
+    
+    // New priority must not be worse than the current one
+    void decreaseKey(int id, Priority priority) {
+        size_t i = pos[id];
+        heap[i].priority = std::move(priority);
+        siftUp(i);
+    }
+    
+    // Inserts id or improves its priority; returns false if neither happened
+    bool pushOrDecrease(int id, const Priority& priority) {
+        if (!contains(id)) {
+            push(id, priority);
+            return true;
+        }
+        if (comp(priority, priorityOf(id))) {
+            decreaseKey(id, priority);
+            return true;
+        }
+        return false;
+    }
+    
+    int topId() const { return heap[0].id; }
+    const Priority& topPriority() const { return heap[0].priority; }
+    
+    void pop() {
+        pos[heap[0].id] = -1;
+        if (heap.size() > 1) {
+            Node last = std::move(heap.back());
+            heap.pop_back();
+            place(0, std::move(last));
+            siftDown(0);
+        } else {
+            heap.pop_back();
+        }
+    }
+    
+    int size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+};
+
+#endif  // DSA_DARY_HEAP_H
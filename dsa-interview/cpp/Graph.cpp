@@ -5,351 +5,121 @@
  */
 
 #include <iostream>
-#include <vector>
-#include <queue>
-#include <stack>
-#include <climits>
-#include <algorithm>
-#include <functional>
+#include <chrono>
+#include <random>
 
-class Graph {
-private:
-    int vertices;
-    std::vector<std::vector<std::pair<int, int>>> adjList;  // {neighbor, weight}
+#include "Graph.h"
 
-public:
-    Graph(int v) : vertices(v), adjList(v) {}
-    
-    void addEdge(int src, int dest, int weight = 1) {
-        adjList[src].push_back({dest, weight});
-    }
-    
-    void addUndirectedEdge(int src, int dest, int weight = 1) {
-        adjList[src].push_back({dest, weight});
-        adjList[dest].push_back({src, weight});
-    }
-    
-    // ==================== BFS ====================
-    std::vector<int> bfs(int start) {
-        std::vector<int> result;
-        std::vector<bool> visited(vertices, false);
-        std::queue<int> q;
-        
-        q.push(start);
-        visited[start] = true;
-        
-        while (!q.empty()) {
-            int node = q.front();
-            q.pop();
-            result.push_back(node);
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (!visited[neighbor]) {
-                    visited[neighbor] = true;
-                    q.push(neighbor);
-                }
-            }
-        }
-        return result;
-    }
+// ==================== Dijkstra Queue Benchmark ====================
+// Random sparse graph with integer weights; run with `./graph --bench`
+template<typename Queue, typename G>
+double timeDijkstra(const G& g, std::vector<int>& dist) {
+    auto start = std::chrono::steady_clock::now();
+    dist = g.template dijkstra<Queue>(0);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmarkDijkstra(int vertices, int edgesPerVertex, int maxWeight) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> node(0, vertices - 1);
+    std::uniform_int_distribution<int> weight(1, maxWeight);
     
-    // BFS for shortest path in unweighted graph
-    std::vector<int> bfsShortestPath(int start, int end) {
-        std::vector<int> parent(vertices, -1);
-        std::vector<bool> visited(vertices, false);
-        std::queue<int> q;
-        
-        q.push(start);
-        visited[start] = true;
-        
-        while (!q.empty()) {
-            int node = q.front();
-            q.pop();
-            
-            if (node == end) break;
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (!visited[neighbor]) {
-                    visited[neighbor] = true;
-                    parent[neighbor] = node;
-                    q.push(neighbor);
-                }
-            }
+    Graph g(vertices);
+    for (int u = 0; u < vertices; u++) {
+        g.addEdge(u, (u + 1) % vertices, weight(rng));  // Keep it strongly connected
+        for (int e = 1; e < edgesPerVertex; e++) {
+            g.addEdge(u, node(rng), weight(rng));
         }
-        
-        // Reconstruct path
-        std::vector<int> path;
-        for (int node = end; node != -1; node = parent[node]) {
-            path.push_back(node);
-        }
-        std::reverse(path.begin(), path.end());
-        
-        if (path[0] != start) return {};  // No path exists
-        return path;
-    }
-    
-    // ==================== DFS ====================
-    std::vector<int> dfs(int start) {
-        std::vector<int> result;
-        std::vector<bool> visited(vertices, false);
-        
-        std::function<void(int)> dfsHelper = [&](int node) {
-            visited[node] = true;
-            result.push_back(node);
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (!visited[neighbor]) {
-                    dfsHelper(neighbor);
-                }
-            }
-        };
-        
-        dfsHelper(start);
-        return result;
     }
     
-    // ==================== Dijkstra ====================
-    std::vector<int> dijkstra(int start) {
-        std::vector<int> dist(vertices, INT_MAX);
-        dist[start] = 0;
-        
-        // {distance, node}
-        std::priority_queue<std::pair<int, int>, 
-                           std::vector<std::pair<int, int>>,
-                           std::greater<>> pq;
-        pq.push({0, start});
-        
-        while (!pq.empty()) {
-            auto [d, node] = pq.top();
-            pq.pop();
-            
-            if (d > dist[node]) continue;
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (dist[node] + weight < dist[neighbor]) {
-                    dist[neighbor] = dist[node] + weight;
-                    pq.push({dist[neighbor], neighbor});
-                }
-            }
+    std::vector<int> expected, dist;
+    std::cout << "Dijkstra on V=" << vertices << ", E=" << (long long)vertices * edgesPerVertex << std::endl;
+    std::cout << "  std::priority_queue: " << timeDijkstra<BinaryHeapQueue>(g, expected) << " ms" << std::endl;
+    std::cout << "  4-ary indexed heap:  " << timeDijkstra<DaryHeapQueue<4>>(g, dist) << " ms"
+              << (dist == expected ? "" : " (MISMATCH)") << std::endl;
+    std::cout << "  8-ary indexed heap:  " << timeDijkstra<DaryHeapQueue<8>>(g, dist) << " ms"
+              << (dist == expected ? "" : " (MISMATCH)") << std::endl;
+    std::cout << "  radix heap:          " << timeDijkstra<RadixHeapQueue>(g, dist) << " ms"
+              << (dist == expected ? "" : " (MISMATCH)") << std::endl;
+    
+    CsrGraph csr(g);
+    std::cout << "  CSR + binary heap:   " << timeDijkstra<BinaryHeapQueue>(csr, dist) << " ms"
+              << (dist == expected ? "" : " (MISMATCH)") << std::endl;
+    std::cout << "  CSR + radix heap:    " << timeDijkstra<RadixHeapQueue>(csr, dist) << " ms"
+              << (dist == expected ? "" : " (MISMATCH)") << std::endl;
+    
+    ThreadPool pool;
+    ParallelBfs parallel(csr, pool);
+    auto start = std::chrono::steady_clock::now();
+    size_t reached = g.bfs(0).size();
+    double sequentialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    size_t parallelReached = parallel.bfs(0).size();
+    double parallelMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "BFS: sequential " << sequentialMs << " ms, direction-optimizing ("
+              << pool.size() << " threads) " << parallelMs << " ms"
+              << (reached == parallelReached ? "" : " (MISMATCH)") << std::endl;
+}
+
+void benchmarkFloydWarshall(int vertices, int edgesPerVertex) {
+    std::mt19937 rng(7);
+    Graph g(vertices);
+    int span = vertices / edgesPerVertex;  // Disjoint ranges avoid parallel edges
+    for (int u = 0; u < vertices; u++) {
+        for (int e = 0; e < edgesPerVertex; e++) {
+            g.addEdge(u, (u + 1 + e * span + rng() % (span - 1)) % vertices, 1 + rng() % 100);
         }
-        return dist;
     }
     
-    // Dijkstra with path reconstruction
-    std::pair<int, std::vector<int>> dijkstraWithPath(int start, int end) {
-        std::vector<int> dist(vertices, INT_MAX);
-        std::vector<int> parent(vertices, -1);
-        dist[start] = 0;
-        
-        std::priority_queue<std::pair<int, int>,
-                           std::vector<std::pair<int, int>>,
-                           std::greater<>> pq;
-        pq.push({0, start});
-        
-        while (!pq.empty()) {
-            auto [d, node] = pq.top();
-            pq.pop();
-            
-            if (d > dist[node]) continue;
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (dist[node] + weight < dist[neighbor]) {
-                    dist[neighbor] = dist[node] + weight;
-                    parent[neighbor] = node;
-                    pq.push({dist[neighbor], neighbor});
-                }
-            }
-        }
-        
-        // Reconstruct path
-        std::vector<int> path;
-        for (int node = end; node != -1; node = parent[node]) {
-            path.push_back(node);
-        }
-        std::reverse(path.begin(), path.end());
-        
-        return {dist[end], path};
-    }
+    auto start = std::chrono::steady_clock::now();
+    auto naive = g.floydWarshall();
+    double naiveMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     
-    // ==================== Bellman-Ford ====================
-    std::vector<int> bellmanFord(int start) {
-        std::vector<int> dist(vertices, INT_MAX);
-        dist[start] = 0;
-        
-        for (int i = 0; i < vertices - 1; i++) {
-            for (int u = 0; u < vertices; u++) {
-                if (dist[u] == INT_MAX) continue;
-                for (auto& [v, w] : adjList[u]) {
-                    if (dist[u] + w < dist[v]) {
-                        dist[v] = dist[u] + w;
-                    }
-                }
-            }
-        }
-        
-        // Check for negative cycle
-        for (int u = 0; u < vertices; u++) {
-            if (dist[u] == INT_MAX) continue;
-            for (auto& [v, w] : adjList[u]) {
-                if (dist[u] + w < dist[v]) {
-                    throw std::runtime_error("Negative cycle detected");
-                }
-            }
-        }
-        
-        return dist;
-    }
+    ThreadPool pool;
+    start = std::chrono::steady_clock::now();
+    auto blocked = g.floydWarshallBlocked(&pool);
+    double blockedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     
-    // ==================== Floyd-Warshall ====================
-    std::vector<std::vector<int>> floydWarshall() {
-        const int INF = INT_MAX / 2;
-        std::vector<std::vector<int>> dist(vertices, std::vector<int>(vertices, INF));
-        
-        for (int i = 0; i < vertices; i++) {
-            dist[i][i] = 0;
-        }
-        
-        for (int u = 0; u < vertices; u++) {
-            for (auto& [v, w] : adjList[u]) {
-                dist[u][v] = w;
-            }
-        }
-        
-        for (int k = 0; k < vertices; k++) {
-            for (int i = 0; i < vertices; i++) {
-                for (int j = 0; j < vertices; j++) {
-                    if (dist[i][k] + dist[k][j] < dist[i][j]) {
-                        dist[i][j] = dist[i][k] + dist[k][j];
-                    }
-                }
-            }
-        }
-        
-        return dist;
+    bool same = true;
+    for (int i = 0; i < vertices && same; i++) {
+        same = std::equal(naive[i].begin(), naive[i].end(), blocked.row(i));
     }
-    
-    // ==================== Topological Sort (Kahn's) ====================
-    std::vector<int> topologicalSort() {
-        std::vector<int> inDegree(vertices, 0);
-        for (int u = 0; u < vertices; u++) {
-            for (auto& [v, w] : adjList[u]) {
-                inDegree[v]++;
-            }
-        }
-        
-        std::queue<int> q;
-        for (int i = 0; i < vertices; i++) {
-            if (inDegree[i] == 0) {
-                q.push(i);
-            }
-        }
-        
-        std::vector<int> result;
-        while (!q.empty()) {
-            int node = q.front();
-            q.pop();
-            result.push_back(node);
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (--inDegree[neighbor] == 0) {
-                    q.push(neighbor);
-                }
-            }
-        }
-        
-        if (result.size() != vertices) {
-            throw std::runtime_error("Graph has a cycle");
-        }
-        
-        return result;
-    }
-    
-    // ==================== Cycle Detection ====================
-    bool hasCycleDirected() {
-        std::vector<int> color(vertices, 0);  // 0: white, 1: gray, 2: black
-        
-        std::function<bool(int)> dfs = [&](int node) -> bool {
-            color[node] = 1;
-            
-            for (auto& [neighbor, weight] : adjList[node]) {
-                if (color[neighbor] == 1) return true;  // Back edge
-                if (color[neighbor] == 0 && dfs(neighbor)) return true;
-            }
-            
-            color[node] = 2;
-            return false;
-        };
-        
-        for (int i = 0; i < vertices; i++) {
-            if (color[i] == 0 && dfs(i)) return true;
-        }
-        return false;
+    std::cout << "Floyd-Warshall on V=" << vertices << ": naive " << naiveMs << " ms, blocked ("
+              << pool.size() << " threads) " << blockedMs << " ms" << (same ? "" : " (MISMATCH)") << std::endl;
+}
+
+void benchmarkMST(int vertices, int edgesPerVertex) {
+    std::mt19937 rng(11);
+    Graph g(vertices);
+    for (long long e = 0; e < (long long)vertices * edgesPerVertex / 2; e++) {
+        g.addUndirectedEdge(rng() % vertices, rng() % vertices, 1 + rng() % 100000);
     }
     
-    // ==================== Prim's MST ====================
-    std::vector<std::tuple<int, int, int>> primMST() {
-        std::vector<std::tuple<int, int, int>> mst;
-        std::vector<bool> visited(vertices, false);
-        
-        // {weight, from, to}
-        std::priority_queue<std::tuple<int, int, int>,
-                           std::vector<std::tuple<int, int, int>>,
-                           std::greater<>> pq;
-        
-        visited[0] = true;
-        for (auto& [neighbor, weight] : adjList[0]) {
-            pq.push({weight, 0, neighbor});
-        }
-        
-        while (!pq.empty() && mst.size() < vertices - 1) {
-            auto [w, from, to] = pq.top();
-            pq.pop();
-            
-            if (visited[to]) continue;
-            
-            visited[to] = true;
-            mst.push_back({from, to, w});
-            
-            for (auto& [neighbor, weight] : adjList[to]) {
-                if (!visited[neighbor]) {
-                    pq.push({weight, to, neighbor});
-                }
-            }
-        }
-        
-        return mst;
+    auto time = [](auto&& run, long long& total) {
+        auto start = std::chrono::steady_clock::now();
+        total = 0;
+        for (auto& [from, to, weight] : run()) total += weight;
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    ThreadPool pool;
+    long long prim, kruskal, boruvka;
+    double primMs = time([&] { return g.primMST(); }, prim);
+    double kruskalMs = time([&] { return g.kruskalMST(); }, kruskal);
+    double boruvkaMs = time([&] { return g.boruvkaMST(pool); }, boruvka);
+    std::cout << "MST on V=" << vertices << ": Prim " << primMs << " ms, Kruskal " << kruskalMs
+              << " ms, Boruvka (" << pool.size() << " threads) " << boruvkaMs << " ms"
+              << (prim == kruskal && kruskal == boruvka ? "" : " (MISMATCH)") << std::endl;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) {
+        benchmarkDijkstra(1 << 20, 8, 1000);
+        benchmarkFloydWarshall(1024, 8);
+        benchmarkMST(1 << 20, 8);
+        return 0;
     }
     
-    // ==================== Bipartite Check ====================
-    bool isBipartite() {
-        std::vector<int> color(vertices, -1);
-        
-        for (int start = 0; start < vertices; start++) {
-            if (color[start] != -1) continue;
-            
-            std::queue<int> q;
-            q.push(start);
-            color[start] = 0;
-            
-            while (!q.empty()) {
-                int node = q.front();
-                q.pop();
-                
-                for (auto& [neighbor, weight] : adjList[node]) {
-                    if (color[neighbor] == -1) {
-                        color[neighbor] = 1 - color[node];
-                        q.push(neighbor);
-                    } else if (color[neighbor] == color[node]) {
-                        return false;
-                    }
-                }
-            }
-        }
-        return true;
-    }
-};
-
-int main() {
     Graph g(6);
     g.addEdge(0, 1, 4);
     g.addEdge(0, 2, 2);
@@ -375,6 +145,11 @@ int main() {
         std::cout << "  Distance to " << i << ": " << dist[i] << std::endl;
     }
     
+    auto [cost, path] = g.dijkstraWithPath<RadixHeapQueue>(0, 5);
+    std::cout << "Radix-heap shortest path 0 -> 5 (cost " << cost << "): ";  // cost 14
+    for (int x : path) std::cout << x << " ";
+    std::cout << std::endl;
+    
     // Topological Sort
     Graph dag(6);
     dag.addEdge(5, 2);
@@ -405,5 +180,29 @@ int main() {
         std::cout << "  " << from << " - " << to << " : " << weight << std::endl;
     }
     
+    auto totalWeight = [](const std::vector<std::tuple<int, int, int>>& forest) {
+        long long total = 0;
+        for (auto& [from, to, weight] : forest) total += weight;
+        return total;
+    };
+    ThreadPool mstPool(4);
+    std::cout << "Kruskal MST weight: " << totalWeight(mstGraph.kruskalMST()) << std::endl;          // 16
+    std::cout << "Boruvka MST weight: " << totalWeight(mstGraph.boruvkaMST(mstPool)) << std::endl;  // 16
+    
+    // Same algorithms on the CSR layout
+    CsrGraph csr(g);
+    std::cout << "\nCSR Dijkstra from 0: ";
+    for (int d : csr.dijkstra(0)) std::cout << d << " ";  // 0 4 2 9 11 14
+    std::cout << std::endl;
+    ThreadPool pool(4);
+    ParallelBfs parallelBfs(csr, pool);
+    std::cout << "Parallel BFS levels from 0: ";
+    for (int d : parallelBfs.levels(0)) std::cout << d << " ";  // 0 1 1 2 2 3
+    std::cout << std::endl;
+    
+    std::cout << "CSR topological sort: ";
+    for (int x : CsrGraph(dag).topologicalSort()) std::cout << x << " ";
+    std::cout << std::endl;
+    
     return 0;
 }
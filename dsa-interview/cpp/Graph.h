@@ -0,0 +1,1100 @@
+/**
+ * Graph Algorithms Implementation in C++
+ * 
+ * Essential algorithms for FAANG interviews
+ * 
+ * Shared by Graph.cpp and the bench/ suite.
+ */
+
+#ifndef DSA_GRAPH_H
+#define DSA_GRAPH_H
+
+#include <vector>
+#include <queue>
+#include <stack>
+#include <climits>
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <cstring>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+#include "DaryHeap.h"
+#include "ThreadPool.h"
+#include "UnionFind.h"
+#include "Stats.h"
+
+// ==================== Dijkstra Queue Policies ====================
+// A policy is constructed with the vertex count and exposes
+//   update(node, dist)  insert node or lower its tentative distance
+//   popMin()            remove and return {dist, node} with the smallest dist
+//   empty()
+// Lazy policies may return stale entries; Dijkstra skips those by comparing
+// against dist[], so every policy plugs into the same loop.
+
+// Binary heap with duplicate entries (the classic std::priority_queue path)
+class BinaryHeapQueue {
+private:
+    std::priority_queue<std::pair<int, int>,
+                        std::vector<std::pair<int, int>>,
+                        std::greater<>> pq;
+
+public:
+    explicit BinaryHeapQueue(int) {}
+    
+    void update(int node, int dist) { pq.push({dist, node}); }
+    
+    std::pair<int, int> popMin() {
+        auto top = pq.top();
+        pq.pop();
+        return top;
+    }
+    
+    bool empty() const { return pq.empty(); }
+};
+
+// Indexed d-ary heap: one entry per vertex, decrease-key in place
+template<int D = 4>
+class DaryHeapQueue {
+private:
+    IndexedDaryHeap<int, D> heap;
+
+public:
+    explicit DaryHeapQueue(int vertices) : heap(vertices) {}
+    
+    void update(int node, int dist) { heap.pushOrDecrease(node, dist); }
+    
+    std::pair<int, int> popMin() {
+        std::pair<int, int> top = {heap.topPriority(), heap.topId()};
+        heap.pop();
+        return top;
+    }
+    
+    bool empty() const { return heap.empty(); }
+};
+
+// Monotone radix heap for non-negative integer distances. Bucket b holds keys
+// whose highest bit differing from the last popped key is b - 1, so each key
+// only moves to lower buckets: O(log C) amortized per vertex with no
+// comparisons between heap entries. Indexed, so there are no stale duplicates.
+class RadixHeapQueue {
+private:
+    static const int BUCKETS = 33;
+    
+    std::vector<int> buckets[BUCKETS];
+    std::vector<unsigned> key;
+    std::vector<int> bucketOf;  // -1 if not queued
+    std::vector<int> indexOf;   // position inside its bucket
+    unsigned last;
+    int count;
+    
+    static int bucketFor(unsigned k, unsigned last) {
+        return k == last ? 0 : 32 - __builtin_clz(k ^ last);
+    }
+    
+    void insert(int node) {
+        int b = bucketFor(key[node], last);
+        bucketOf[node] = b;
+        indexOf[node] = buckets[b].size();
+        buckets[b].push_back(node);
+    }
+    
+    void remove(int node) {
+        std::vector<int>& bucket = buckets[bucketOf[node]];
+        int moved = bucket.back();
+        bucket[indexOf[node]] = moved;
+        indexOf[moved] = indexOf[node];
+        bucket.pop_back();
+        bucketOf[node] = -1;
+    }
+
+public:
+    explicit RadixHeapQueue(int vertices)
+        : key(vertices), bucketOf(vertices, -1), indexOf(vertices), last(0), count(0) {}
+    
+    // dist must be >= the last popped distance (true for Dijkstra)
+    void update(int node, int dist) {
+        if (bucketOf[node] != -1) {
+            if (static_cast<unsigned>(dist) >= key[node]) return;
+            remove(node);
+        } else {
+            count++;
+        }
+        key[node] = dist;
+        insert(node);
+    }
+    
+    std::pair<int, int> popMin() {
+        if (buckets[0].empty()) {
+            int b = 1;
+            while (buckets[b].empty()) b++;
+            
+            // Re-bucket around the new minimum; every entry drops to a lower bucket
+            std::vector<int> pending;
+            pending.swap(buckets[b]);
+            last = key[pending[0]];
+            for (int node : pending) last = std::min(last, key[node]);
+            for (int node : pending) insert(node);
+        }
+        
+        int node = buckets[0].back();
+        buckets[0].pop_back();
+        bucketOf[node] = -1;
+        count--;
+        return {static_cast<int>(key[node]), node};
+    }
+    
+    bool empty() const { return count == 0; }
+};
+
+// ==================== Blocked Floyd-Warshall Kernel ====================
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Flat row-major n x n distance table (one allocation instead of one per row)
+class DistanceMatrix {
+private:
+    int n;
+    int stride;  // Row pitch, padded up to a whole number of tiles
+    std::vector<int> data;
+
+public:
+    DistanceMatrix(int n, int stride, int fill) : n(n), stride(stride), data((size_t)stride * stride, fill) {}
+    
+    int size() const { return n; }
+    int pitch() const { return stride; }
+    int* row(int i) { return data.data() + (size_t)i * stride; }
+    const int* row(int i) const { return data.data() + (size_t)i * stride; }
+    int at(int i, int j) const { return row(i)[j]; }
+    int& at(int i, int j) { return row(i)[j]; }
+};
+
+// C[i][j] = min(C[i][j], A[i][k] + B[k][j]) over one tile, k outermost so the
+// same kernel is valid when C aliases A or B (diagonal and row/column phases).
+// The j loop is the min-plus inner product: 8 lanes per vpaddd/vpminsd on AVX2.
+inline void minPlusTile(int* C, const int* A, const int* B, int stride, int tile) {
+    for (int k = 0; k < tile; k++) {
+        const int* bk = B + (size_t)k * stride;
+        for (int i = 0; i < tile; i++) {
+            int* ci = C + (size_t)i * stride;
+            const int aik = A[(size_t)i * stride + k];
+            int j = 0;
+#if defined(__AVX2__)
+            const __m256i a = _mm256_set1_epi32(aik);
+            for (; j + 8 <= tile; j += 8) {
+                __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ci + j));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bk + j));
+                c = _mm256_min_epi32(c, _mm256_add_epi32(a, b));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(ci + j), c);
+            }
+#endif
+            for (; j < tile; j++) {
+                ci[j] = std::min(ci[j], aik + bk[j]);
+            }
+        }
+    }
+}
+
+// ==================== MST Edge Sorting ====================
+struct WeightedEdge {
+    int from, to, weight;
+};
+
+// Signed weight -> unsigned key with the same order
+inline uint32_t weightKey(int weight) { return (uint32_t)weight ^ 0x80000000u; }
+
+// Stable LSD radix sort on the weight key, two 16-bit passes; small inputs
+// fall back to std::stable_sort
+inline void radixSortByWeight(std::vector<WeightedEdge>& edges) {
+    if (edges.size() < 4096) {
+        std::stable_sort(edges.begin(), edges.end(),
+                         [](const WeightedEdge& a, const WeightedEdge& b) { return a.weight < b.weight; });
+        return;
+    }
+    std::vector<WeightedEdge> buffer(edges.size());
+    std::vector<size_t> count(1 << 16);
+    for (int shift = 0; shift < 32; shift += 16) {
+        std::fill(count.begin(), count.end(), 0);
+        for (const WeightedEdge& e : edges) count[(weightKey(e.weight) >> shift) & 0xFFFF]++;
+        size_t sum = 0;
+        for (size_t& c : count) {
+            size_t bucket = c;
+            c = sum;
+            sum += bucket;
+        }
+        for (const WeightedEdge& e : edges) buffer[count[(weightKey(e.weight) >> shift) & 0xFFFF]++] = e;
+        edges.swap(buffer);
+    }
+}
+
+// ==================== Graph Algorithms ====================
+// Every algorithm is written once against the representation's
+// `vertexCount()` and `neighbors(u)` (a range of {neighbor, weight} pairs);
+// Graph and CsrGraph plug in through CRTP.
+template<typename Derived>
+class GraphAlgorithms {
+protected:
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+    
+    // Searches are const and may run concurrently, hence SharedCounter
+    DSA_STAT(mutable stats::SearchCounters dijkstraCounters;)
+    DSA_STAT(mutable stats::SearchCounters bellmanFordCounters;)
+
+public:
+#if DSA_STATS_ENABLED
+    const stats::SearchCounters& dijkstraStats() const { return dijkstraCounters; }
+    const stats::SearchCounters& bellmanFordStats() const { return bellmanFordCounters; }
+#endif
+    
+    // Search counters and latency histograms; writes nothing unless built with DSA_STATS
+    void exportStats([[maybe_unused]] stats::Exposition& out, [[maybe_unused]] stats::Labels labels) const {
+#if DSA_STATS_ENABLED
+        labels.emplace_back("algorithm", "dijkstra");
+        dijkstraCounters.exportTo(out, labels);
+        labels.back().second = "bellman_ford";
+        bellmanFordCounters.exportTo(out, labels);
+#endif
+    }
+    
+
+    // ==================== BFS ====================
+    std::vector<int> bfs(int start) const {
+        const int vertices = self().vertexCount();
+        std::vector<int> result;
+        std::vector<bool> visited(vertices, false);
+        std::queue<int> q;
+        
+        q.push(start);
+        visited[start] = true;
+        
+        while (!q.empty()) {
+            int node = q.front();
+            q.pop();
+            result.push_back(node);
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                if (!visited[neighbor]) {
+                    visited[neighbor] = true;
+                    q.push(neighbor);
+                }
+            }
+        }
+        return result;
+    }
+    
+    // BFS for shortest path in unweighted graph
+    std::vector<int> bfsShortestPath(int start, int end) const {
+        const int vertices = self().vertexCount();
+        std::vector<int> parent(vertices, -1);
+        std::vector<bool> visited(vertices, false);
+        std::queue<int> q;
+        
+        q.push(start);
+        visited[start] = true;
+        
+        while (!q.empty()) {
+            int node = q.front();
+            q.pop();
+            
+            if (node == end) break;
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                if (!visited[neighbor]) {
+                    visited[neighbor] = true;
+                    parent[neighbor] = node;
+                    q.push(neighbor);
+                }
+            }
+        }
+        
+        // Reconstruct path
+        std::vector<int> path;
+        for (int node = end; node != -1; node = parent[node]) {
+            path.push_back(node);
+        }
+        std::reverse(path.begin(), path.end());
+        
+        if (path[0] != start) return {};  // No path exists
+        return path;
+    }
+    
+    // ==================== DFS ====================
+    std::vector<int> dfs(int start) const {
+        const int vertices = self().vertexCount();
+        std::vector<int> result;
+        std::vector<bool> visited(vertices, false);
+        
+        std::function<void(int)> dfsHelper = [&](int node) {
+            visited[node] = true;
+            result.push_back(node);
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                if (!visited[neighbor]) {
+                    dfsHelper(neighbor);
+                }
+            }
+        };
+        
+        dfsHelper(start);
+        return result;
+    }
+    
+    // ==================== Dijkstra ====================
+    // Queue is one of the policies above, e.g. dijkstra<RadixHeapQueue>(0)
+    template<typename Queue = BinaryHeapQueue>
+    std::vector<int> dijkstra(int start) const {
+        DSA_STAT_LATENCY(dijkstraCounters.latency);
+        DSA_STAT(uint64_t relaxed = 0, improved = 0, stale = 0;)
+        const int vertices = self().vertexCount();
+        std::vector<int> dist(vertices, INT_MAX);
+        dist[start] = 0;
+        
+        Queue pq(vertices);
+        pq.update(start, 0);
+        
+        while (!pq.empty()) {
+            auto [d, node] = pq.popMin();
+            
+            if (d > dist[node]) {  // Stale entry from a lazy queue
+                DSA_STAT(stale++;)
+                continue;
+            }
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                DSA_STAT(relaxed++;)
+                if (dist[node] + weight < dist[neighbor]) {
+                    DSA_STAT(improved++;)
+                    dist[neighbor] = dist[node] + weight;
+                    pq.update(neighbor, dist[neighbor]);
+                }
+            }
+        }
+        DSA_STAT(dijkstraCounters.flush(relaxed, improved, improved + 1, stale);)  // One push per improvement
+        return dist;
+    }
+    
+    // Dijkstra with path reconstruction
+    template<typename Queue = BinaryHeapQueue>
+    std::pair<int, std::vector<int>> dijkstraWithPath(int start, int end) const {
+        DSA_STAT_LATENCY(dijkstraCounters.latency);
+        DSA_STAT(uint64_t relaxed = 0, improved = 0, stale = 0;)
+        const int vertices = self().vertexCount();
+        std::vector<int> dist(vertices, INT_MAX);
+        std::vector<int> parent(vertices, -1);
+        dist[start] = 0;
+        
+        Queue pq(vertices);
+        pq.update(start, 0);
+        
+        while (!pq.empty()) {
+            auto [d, node] = pq.popMin();
+            
+            if (d > dist[node]) {
+                DSA_STAT(stale++;)
+                continue;
+            }
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                DSA_STAT(relaxed++;)
+                if (dist[node] + weight < dist[neighbor]) {
+                    DSA_STAT(improved++;)
+                    dist[neighbor] = dist[node] + weight;
+                    parent[neighbor] = node;
+                    pq.update(neighbor, dist[neighbor]);
+                }
+            }
+        }
+        DSA_STAT(dijkstraCounters.flush(relaxed, improved, improved + 1, stale);)
+        
+        // Reconstruct path
+        std::vector<int> path;
+        for (int node = end; node != -1; node = parent[node]) {
+            path.push_back(node);
+        }
+        std::reverse(path.begin(), path.end());
+        
+        return {dist[end], path};
+    }
+    
+    // ==================== Bellman-Ford ====================
+    std::vector<int> bellmanFord(int start) const {
+        DSA_STAT_LATENCY(bellmanFordCounters.latency);
+        DSA_STAT(uint64_t relaxed = 0, improved = 0;)
+        const int vertices = self().vertexCount();
+        std::vector<int> dist(vertices, INT_MAX);
+        dist[start] = 0;
+        
+        for (int i = 0; i < vertices - 1; i++) {
+            for (int u = 0; u < vertices; u++) {
+                if (dist[u] == INT_MAX) continue;
+                for (auto [v, w] : self().neighbors(u)) {
+                    DSA_STAT(relaxed++;)
+                    if (dist[u] + w < dist[v]) {
+                        DSA_STAT(improved++;)
+                        dist[v] = dist[u] + w;
+                    }
+                }
+            }
+        }
+        DSA_STAT(bellmanFordCounters.flush(relaxed, improved, 0, 0);)  // No queue
+        
+        // Check for negative cycle
+        for (int u = 0; u < vertices; u++) {
+            if (dist[u] == INT_MAX) continue;
+            for (auto [v, w] : self().neighbors(u)) {
+                if (dist[u] + w < dist[v]) {
+                    throw std::runtime_error("Negative cycle detected");
+                }
+            }
+        }
+        
+        return dist;
+    }
+    
+    // ==================== Floyd-Warshall ====================
+    std::vector<std::vector<int>> floydWarshall() const {
+        const int vertices = self().vertexCount();
+        const int INF = INT_MAX / 2;
+        std::vector<std::vector<int>> dist(vertices, std::vector<int>(vertices, INF));
+        
+        for (int i = 0; i < vertices; i++) {
+            dist[i][i] = 0;
+        }
+        
+        for (int u = 0; u < vertices; u++) {
+            for (auto [v, w] : self().neighbors(u)) {
+                dist[u][v] = w;
+            }
+        }
+        
+        for (int k = 0; k < vertices; k++) {
+            for (int i = 0; i < vertices; i++) {
+                for (int j = 0; j < vertices; j++) {
+                    if (dist[i][k] + dist[k][j] < dist[i][j]) {
+                        dist[i][j] = dist[i][k] + dist[k][j];
+                    }
+                }
+            }
+        }
+        
+        return dist;
+    }
+    
+    // Blocked (tiled) Floyd-Warshall on a flat matrix. For each diagonal tile
+    // kb: relax the tile itself, then every tile in row/column kb (independent
+    // of each other), then all remaining tiles (independent again). Each tile
+    // phase runs across `pool` when given. Parallel edges keep the lightest.
+    DistanceMatrix floydWarshallBlocked(ThreadPool* pool = nullptr, int tile = 64) const {
+        const int vertices = self().vertexCount();
+        const int INF = INT_MAX / 2;
+        tile = std::max(8, (tile + 7) / 8 * 8);
+        const int tiles = std::max(1, (vertices + tile - 1) / tile);
+        DistanceMatrix dist(vertices, tiles * tile, INF);
+        const int stride = dist.pitch();
+        
+        for (int i = 0; i < vertices; i++) {
+            dist.at(i, i) = 0;
+        }
+        for (int u = 0; u < vertices; u++) {
+            for (auto [v, w] : self().neighbors(u)) {
+                dist.at(u, v) = std::min(dist.at(u, v), w);
+            }
+        }
+        
+        auto tileAt = [&](int bi, int bj) { return dist.row(bi * tile) + bj * tile; };
+        auto forEach = [&](size_t count, auto&& body) {
+            if (pool) {
+                pool->parallelFor(count, 1, [&](size_t lo, size_t hi, unsigned) {
+                    for (size_t t = lo; t < hi; t++) body(t);
+                });
+            } else {
+                for (size_t t = 0; t < count; t++) body(t);
+            }
+        };
+        
+        for (int kb = 0; kb < tiles; kb++) {
+            int* diag = tileAt(kb, kb);
+            minPlusTile(diag, diag, diag, stride, tile);
+            
+            // Row kb and column kb: tasks [0, tiles) are (kb, j), the rest (i, kb)
+            forEach(2 * tiles, [&](size_t t) {
+                int other = t % tiles;
+                if (other == kb) return;
+                if (t < (size_t)tiles) {
+                    int* c = tileAt(kb, other);
+                    minPlusTile(c, diag, c, stride, tile);
+                } else {
+                    int* c = tileAt(other, kb);
+                    minPlusTile(c, c, diag, stride, tile);
+                }
+            });
+            
+            forEach((size_t)tiles * tiles, [&](size_t t) {
+                int bi = t / tiles, bj = t % tiles;
+                if (bi == kb || bj == kb) return;
+                minPlusTile(tileAt(bi, bj), tileAt(bi, kb), tileAt(kb, bj), stride, tile);
+            });
+        }
+        
+        return dist;
+    }
+    
+    // ==================== Topological Sort (Kahn's) ====================
+    std::vector<int> topologicalSort() const {
+        const int vertices = self().vertexCount();
+        std::vector<int> inDegree(vertices, 0);
+        for (int u = 0; u < vertices; u++) {
+            for (auto [v, w] : self().neighbors(u)) {
+                inDegree[v]++;
+            }
+        }
+        
+        std::queue<int> q;
+        for (int i = 0; i < vertices; i++) {
+            if (inDegree[i] == 0) {
+                q.push(i);
+            }
+        }
+        
+        std::vector<int> result;
+        while (!q.empty()) {
+            int node = q.front();
+            q.pop();
+            result.push_back(node);
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                if (--inDegree[neighbor] == 0) {
+                    q.push(neighbor);
+                }
+            }
+        }
+        
+        if (result.size() != vertices) {
+            throw std::runtime_error("Graph has a cycle");
+        }
+        
+        return result;
+    }
+    
+    // ==================== Cycle Detection ====================
+    bool hasCycleDirected() const {
+        const int vertices = self().vertexCount();
+        std::vector<int> color(vertices, 0);  // 0: white, 1: gray, 2: black
+        
+        std::function<bool(int)> dfs = [&](int node) -> bool {
+            color[node] = 1;
+            
+            for (auto [neighbor, weight] : self().neighbors(node)) {
+                if (color[neighbor] == 1) return true;  // Back edge
+                if (color[neighbor] == 0 && dfs(neighbor)) return true;
+            }
+            
+            color[node] = 2;
+            return false;
+        };
+        
+        for (int i = 0; i < vertices; i++) {
+            if (color[i] == 0 && dfs(i)) return true;
+        }
+        return false;
+    }
+    
+    // ==================== Prim's MST ====================
+    // Grows a tree from every vertex not yet reached, so a disconnected
+    // graph yields a spanning forest rather than only vertex 0's tree
+    std::vector<std::tuple<int, int, int>> primMST() const {
+        const int vertices = self().vertexCount();
+        std::vector<std::tuple<int, int, int>> mst;
+        std::vector<bool> visited(vertices, false);
+        
+        // {weight, from, to}
+        std::priority_queue<std::tuple<int, int, int>,
+                           std::vector<std::tuple<int, int, int>>,
+                           std::greater<>> pq;
+        
+        for (int start = 0; start < vertices; start++) {
+            if (visited[start]) continue;
+            
+            visited[start] = true;
+            for (auto [neighbor, weight] : self().neighbors(start)) {
+                pq.push({weight, start, neighbor});
+            }
+            
+            while (!pq.empty()) {
+                auto [w, from, to] = pq.top();
+                pq.pop();
+                
+                if (visited[to]) continue;
+                
+                visited[to] = true;
+                mst.push_back({from, to, w});
+                
+                for (auto [neighbor, weight] : self().neighbors(to)) {
+                    if (!visited[neighbor]) {
+                        pq.push({weight, to, neighbor});
+                    }
+                }
+            }
+        }
+        
+        return mst;
+    }
+    
+    // ==================== Kruskal's MST ====================
+    // Minimum spanning forest; every stored edge is treated as undirected.
+    // Edges are radix-sorted by weight, then joined through UnionFind.
+    std::vector<std::tuple<int, int, int>> kruskalMST() const {
+        const int vertices = self().vertexCount();
+        std::vector<WeightedEdge> edges;
+        for (int u = 0; u < vertices; u++) {
+            for (auto [v, weight] : self().neighbors(u)) {
+                if (u != v) edges.push_back({u, v, weight});
+            }
+        }
+        radixSortByWeight(edges);
+        
+        std::vector<std::tuple<int, int, int>> forest;
+        UnionFind uf(vertices);
+        for (const WeightedEdge& e : edges) {
+            if (uf.getComponents() == 1) break;
+            if (uf.unite(e.from, e.to)) forest.push_back({e.from, e.to, e.weight});
+        }
+        return forest;
+    }
+    
+    // ==================== Parallel Borůvka MST ====================
+    // Minimum spanning forest in O(log V) rounds. Each round, every edge
+    // between two components offers itself to both endpoints' components
+    // through an atomic min on (weight, position); every component then
+    // takes its lightest edge. The unique ordering means the chosen edges
+    // are acyclic, so ConcurrentUnionFind only rejects an edge picked by
+    // both of its components at once. Edges inside one component are
+    // compacted away in parallel before the next round.
+    std::vector<std::tuple<int, int, int>> boruvkaMST(ThreadPool& pool) const {
+        const int vertices = self().vertexCount();
+        std::vector<WeightedEdge> edges;
+        for (int u = 0; u < vertices; u++) {
+            for (auto [v, weight] : self().neighbors(u)) {
+                if (u != v) edges.push_back({u, v, weight});
+            }
+        }
+        
+        const size_t grain = 1 << 14;
+        ConcurrentUnionFind uf(vertices);
+        std::vector<int> component(vertices);
+        std::unique_ptr<std::atomic<uint64_t>[]> best(new std::atomic<uint64_t>[vertices]);
+        std::vector<std::tuple<int, int, int>> forest(std::max(vertices - 1, 0));
+        std::atomic<size_t> forestSize(0);
+        std::vector<WeightedEdge> survivors;
+        
+        while (!edges.empty()) {
+            pool.parallelFor(vertices, grain, [&](size_t lo, size_t hi, unsigned) {
+                for (size_t v = lo; v < hi; v++) {
+                    component[v] = uf.find(v);
+                    best[v].store(UINT64_MAX, std::memory_order_relaxed);
+                }
+            });
+            
+            // Drop edges that now sit inside one component
+            std::vector<size_t> chunkStart((edges.size() + grain - 1) / grain + 1, 0);
+            auto internal = [&](const WeightedEdge& e) { return component[e.from] == component[e.to]; };
+            pool.parallelFor(edges.size(), grain, [&](size_t lo, size_t hi, unsigned) {
+                size_t kept = 0;
+                for (size_t i = lo; i < hi; i++) kept += !internal(edges[i]);
+                chunkStart[lo / grain + 1] = kept;
+            });
+            for (size_t c = 1; c < chunkStart.size(); c++) chunkStart[c] += chunkStart[c - 1];
+            survivors.resize(chunkStart.back());
+            pool.parallelFor(edges.size(), grain, [&](size_t lo, size_t hi, unsigned) {
+                size_t out = chunkStart[lo / grain];
+                for (size_t i = lo; i < hi; i++) {
+                    if (!internal(edges[i])) survivors[out++] = edges[i];
+                }
+            });
+            edges.swap(survivors);
+            if (edges.empty()) break;
+            
+            pool.parallelFor(edges.size(), grain, [&](size_t lo, size_t hi, unsigned) {
+                auto offer = [&](int c, uint64_t key) {
+                    uint64_t current = best[c].load(std::memory_order_relaxed);
+                    while (key < current &&
+                           !best[c].compare_exchange_weak(current, key, std::memory_order_relaxed)) {
+                    }
+                };
+                for (size_t i = lo; i < hi; i++) {
+                    uint64_t key = (uint64_t)weightKey(edges[i].weight) << 32 | i;
+                    offer(component[edges[i].from], key);
+                    offer(component[edges[i].to], key);
+                }
+            });
+            
+            pool.parallelFor(vertices, grain, [&](size_t lo, size_t hi, unsigned) {
+                for (size_t v = lo; v < hi; v++) {
+                    uint64_t key = best[v].load(std::memory_order_relaxed);
+                    if (component[v] != (int)v || key == UINT64_MAX) continue;
+                    const WeightedEdge& e = edges[(uint32_t)key];
+                    if (uf.unite(e.from, e.to)) {
+                        forest[forestSize.fetch_add(1, std::memory_order_relaxed)] = {e.from, e.to, e.weight};
+                    }
+                }
+            });
+        }
+        
+        forest.resize(forestSize.load());
+        return forest;
+    }
+    
+    // ==================== Bipartite Check ====================
+    bool isBipartite() const {
+        const int vertices = self().vertexCount();
+        std::vector<int> color(vertices, -1);
+        
+        for (int start = 0; start < vertices; start++) {
+            if (color[start] != -1) continue;
+            
+            std::queue<int> q;
+            q.push(start);
+            color[start] = 0;
+            
+            while (!q.empty()) {
+                int node = q.front();
+                q.pop();
+                
+                for (auto [neighbor, weight] : self().neighbors(node)) {
+                    if (color[neighbor] == -1) {
+                        color[neighbor] = 1 - color[node];
+                        q.push(neighbor);
+                    } else if (color[neighbor] == color[node]) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// ==================== Adjacency-List Graph ====================
+class Graph : public GraphAlgorithms<Graph> {
+private:
+    int vertices;
+    std::vector<std::vector<std::pair<int, int>>> adjList;  // {neighbor, weight}
+
+public:
+    Graph(int v) : vertices(v), adjList(v) {}
+    
+    void addEdge(int src, int dest, int weight = 1) {
+        adjList[src].push_back({dest, weight});
+    }
+    
+    void addUndirectedEdge(int src, int dest, int weight = 1) {
+        adjList[src].push_back({dest, weight});
+        adjList[dest].push_back({src, weight});
+    }
+    
+    int vertexCount() const { return vertices; }
+    
+    const std::vector<std::pair<int, int>>& neighbors(int u) const { return adjList[u]; }
+};
+
+// ==================== CSR Graph ====================
+// Immutable compressed-sparse-row layout: the neighbors of u are
+// targets[offsets[u] .. offsets[u + 1]) with weights in a parallel array
+// (SoA), so a traversal streams through three flat allocations instead of
+// chasing one vector per vertex.
+class CsrGraph : public GraphAlgorithms<CsrGraph> {
+private:
+    int vertices;
+    std::vector<int> offsets;  // size vertices + 1
+    std::vector<int> targets;
+    std::vector<int> weights;
+    
+    // forEachEdge(emit) must call emit(src, dest, weight) once per edge
+    template<typename ForEachEdge>
+    void build(const std::vector<int>& degree, ForEachEdge forEachEdge) {
+        offsets.assign(vertices + 1, 0);
+        for (int u = 0; u < vertices; u++) {
+            offsets[u + 1] = offsets[u] + degree[u];
+        }
+        targets.resize(offsets[vertices]);
+        weights.resize(offsets[vertices]);
+        
+        std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        forEachEdge([&](int u, int v, int w) {
+            int slot = cursor[u]++;
+            targets[slot] = v;
+            weights[slot] = w;
+        });
+    }
+
+public:
+    // Yields {neighbor, weight} by value so algorithms can bind it like an
+    // adjacency-list entry
+    class NeighborRange {
+    private:
+        const int* target;
+        const int* weight;
+        const int* targetEnd;
+    
+    public:
+        class iterator {
+        private:
+            const int* target;
+            const int* weight;
+        
+        public:
+            iterator(const int* target, const int* weight) : target(target), weight(weight) {}
+            std::pair<int, int> operator*() const { return {*target, *weight}; }
+            iterator& operator++() { ++target; ++weight; return *this; }
+            bool operator!=(const iterator& other) const { return target != other.target; }
+        };
+        
+        NeighborRange(const int* target, const int* weight, const int* targetEnd)
+            : target(target), weight(weight), targetEnd(targetEnd) {}
+        
+        iterator begin() const { return {target, weight}; }
+        iterator end() const { return {targetEnd, nullptr}; }
+        size_t size() const { return targetEnd - target; }
+    };
+    
+    explicit CsrGraph(const Graph& g) : vertices(g.vertexCount()) {
+        std::vector<int> degree(vertices);
+        for (int u = 0; u < vertices; u++) {
+            degree[u] = g.neighbors(u).size();
+        }
+        build(degree, [&](auto&& emit) {
+            for (int u = 0; u < vertices; u++) {
+                for (auto [v, w] : g.neighbors(u)) emit(u, v, w);
+            }
+        });
+    }
+    
+    // Builds directly from a {src, dest, weight} edge list, skipping the
+    // intermediate adjacency list for very large inputs
+    CsrGraph(int v, const std::vector<std::tuple<int, int, int>>& edges) : vertices(v) {
+        std::vector<int> degree(vertices, 0);
+        for (auto& [src, dest, weight] : edges) {
+            degree[src]++;
+        }
+        build(degree, [&](auto&& emit) {
+            for (auto& [src, dest, weight] : edges) emit(src, dest, weight);
+        });
+    }
+    
+    int vertexCount() const { return vertices; }
+    int edgeCount() const { return targets.size(); }
+    
+    // Same vertices with every edge reversed
+    CsrGraph transpose() const {
+        std::vector<int> degree(vertices, 0);
+        for (int v : targets) degree[v]++;
+        
+        CsrGraph result(vertices, {});
+        result.build(degree, [&](auto&& emit) {
+            for (int u = 0; u < vertices; u++) {
+                for (int i = offsets[u]; i < offsets[u + 1]; i++) emit(targets[i], u, weights[i]);
+            }
+        });
+        return result;
+    }
+    
+    NeighborRange neighbors(int u) const {
+        return {targets.data() + offsets[u], weights.data() + offsets[u],
+                targets.data() + offsets[u + 1]};
+    }
+};
+
+// ==================== Parallel Direction-Optimizing BFS ====================
+// Frontier-based BFS on a ThreadPool that switches between top-down steps
+// (frontier vertices claim unvisited neighbors through an atomic bitmap) and
+// bottom-up steps (every unvisited vertex scans its in-neighbors for one in
+// the frontier) using Beamer's edge/vertex-count heuristic. Bottom-up steps
+// need in-edges, so the transpose is built once per instance (an undirected
+// graph can reuse itself). The transpose is held by value and picked in run(),
+// so copies stay self-contained; the graph and pool are borrowed and must
+// outlive the instance.
+//
+// Levels and distances match Graph::bfs exactly. The parent tree is a valid
+// BFS tree but may differ from the sequential one, and bfs() lists vertices
+// level by level in ascending id rather than in discovery order.
+class ParallelBfs {
+private:
+    static const int ALPHA = 14;  // Go bottom-up once frontier edges > unexplored / ALPHA
+    static const int BETA = 24;   // Go back top-down once frontier < n / BETA
+    
+    const CsrGraph& graph;
+    CsrGraph reverseStorage;  // Empty when undirected
+    bool undirected;
+    ThreadPool& pool;
+    
+    const CsrGraph& inEdges() const { return undirected ? graph : reverseStorage; }
+    
+    static bool testBit(const std::vector<std::atomic<uint64_t>>& bits, int v) {
+        return (bits[v >> 6].load(std::memory_order_relaxed) >> (v & 63)) & 1;
+    }
+    
+    // Returns true only for the thread that flipped the bit
+    static bool claimBit(std::vector<std::atomic<uint64_t>>& bits, int v) {
+        uint64_t mask = 1ULL << (v & 63);
+        return !(bits[v >> 6].fetch_or(mask, std::memory_order_relaxed) & mask);
+    }
+    
+    void run(int start, std::vector<int>& level, std::vector<int>& parent) const {
+        const int n = graph.vertexCount();
+        const size_t words = (n + 63) / 64;
+        const CsrGraph& reverse = inEdges();
+        level.assign(n, -1);
+        parent.assign(n, -1);
+        
+        std::vector<std::atomic<uint64_t>> visited(words);
+        std::vector<std::atomic<uint64_t>> frontierBits(words);
+        std::vector<std::atomic<uint64_t>> nextBits(words);
+        for (auto& w : visited) w.store(0, std::memory_order_relaxed);
+        
+        std::vector<int> frontier = {start};
+        std::vector<std::vector<int>> localNext(pool.size());
+        claimBit(visited, start);
+        level[start] = 0;
+        
+        long long unexploredEdges = graph.edgeCount() - (long long)graph.neighbors(start).size();
+        long long frontierEdges = graph.neighbors(start).size();
+        long long frontierSize = 1;
+        bool bottomUp = false;
+        
+        for (int depth = 0; frontierSize > 0; depth++) {
+            if (!bottomUp && frontierEdges > unexploredEdges / ALPHA) {
+                bottomUp = true;
+                for (auto& w : frontierBits) w.store(0, std::memory_order_relaxed);
+                for (int v : frontier) frontierBits[v >> 6].fetch_or(1ULL << (v & 63), std::memory_order_relaxed);
+            } else if (bottomUp && frontierSize < n / BETA) {
+                bottomUp = false;
+                frontier.clear();
+                for (size_t w = 0; w < words; w++) {
+                    for (uint64_t bits = frontierBits[w].load(std::memory_order_relaxed); bits; bits &= bits - 1) {
+                        frontier.push_back(static_cast<int>(w * 64 + __builtin_ctzll(bits)));
+                    }
+                }
+            }
+            
+            std::atomic<long long> nextEdges(0), nextSize(0);
+            
+            if (!bottomUp) {
+                pool.parallelFor(frontier.size(), 64, [&](size_t lo, size_t hi, unsigned worker) {
+                    std::vector<int>& out = localNext[worker];
+                    long long edges = 0;
+                    for (size_t i = lo; i < hi; i++) {
+                        int u = frontier[i];
+                        for (auto [v, weight] : graph.neighbors(u)) {
+                            if (!testBit(visited, v) && claimBit(visited, v)) {
+                                level[v] = depth + 1;
+                                parent[v] = u;
+                                out.push_back(v);
+                                edges += graph.neighbors(v).size();
+                            }
+                        }
+                    }
+                    nextEdges += edges;
+                });
+                
+                frontier.clear();
+                for (auto& out : localNext) {
+                    frontier.insert(frontier.end(), out.begin(), out.end());
+                    out.clear();
+                }
+                frontierSize = frontier.size();
+            } else {
+                // Chunks are whole bitmap words, so each word has one writer
+                pool.parallelFor(words, 16, [&](size_t lo, size_t hi, unsigned) {
+                    long long edges = 0, found = 0;
+                    for (size_t w = lo; w < hi; w++) {
+                        uint64_t claimed = 0;
+                        uint64_t unvisited = ~visited[w].load(std::memory_order_relaxed);
+                        for (; unvisited; unvisited &= unvisited - 1) {
+                            int v = static_cast<int>(w * 64 + __builtin_ctzll(unvisited));
+                            if (v >= n) break;
+                            for (auto [u, weight] : reverse.neighbors(v)) {
+                                if (testBit(frontierBits, u)) {
+                                    level[v] = depth + 1;
+                                    parent[v] = u;
+                                    claimed |= 1ULL << (v & 63);
+                                    edges += graph.neighbors(v).size();
+                                    found++;
+                                    break;
+                                }
+                            }
+                        }
+                        nextBits[w].store(claimed, std::memory_order_relaxed);
+                        visited[w].fetch_or(claimed, std::memory_order_relaxed);
+                    }
+                    nextEdges += edges;
+                    nextSize += found;
+                });
+                
+                frontierBits.swap(nextBits);
+                frontierSize = nextSize;
+            }
+            
+            frontierEdges = nextEdges;
+            unexploredEdges -= frontierEdges;
+        }
+    }
+
+public:
+    ParallelBfs(const CsrGraph& graph, ThreadPool& pool, bool undirected = false)
+        : graph(graph),
+          reverseStorage(undirected ? CsrGraph(0, {}) : graph.transpose()),
+          undirected(undirected),
+          pool(pool) {}
+    
+    // A temporary graph would dangle after construction
+    ParallelBfs(CsrGraph&&, ThreadPool&, bool = false) = delete;
+    
+    // Distance in edges from start, -1 if unreachable
+    std::vector<int> levels(int start) const {
+        std::vector<int> level, parent;
+        run(start, level, parent);
+        return level;
+    }
+    
+    // Reachable vertices grouped by level, ascending id within a level
+    std::vector<int> bfs(int start) const {
+        std::vector<int> level, parent;
+        run(start, level, parent);
+        
+        std::vector<int> count;
+        for (int v = 0; v < static_cast<int>(level.size()); v++) {
+            if (level[v] < 0) continue;
+            if (level[v] >= static_cast<int>(count.size())) count.resize(level[v] + 1, 0);
+            count[level[v]]++;
+        }
+        std::vector<int> offset(count.size() + 1, 0);
+        for (size_t d = 0; d < count.size(); d++) offset[d + 1] = offset[d] + count[d];
+        
+        std::vector<int> result(offset.back());
+        for (int v = 0; v < static_cast<int>(level.size()); v++) {
+            if (level[v] >= 0) result[offset[level[v]]++] = v;
+        }
+        return result;
+    }
+    
+    std::vector<int> bfsShortestPath(int start, int end) const {
+        std::vector<int> level, parent;
+        run(start, level, parent);
+        if (level[end] < 0) return {};  // No path exists
+        
+        std::vector<int> path;
+        for (int node = end; node != -1; node = parent[node]) {
+            path.push_back(node);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+#endif  // DSA_GRAPH_H
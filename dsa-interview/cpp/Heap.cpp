@@ -3,122 +3,8 @@
  */
 
 #include <iostream>
-#include <vector>
-#include <queue>
-#include <unordered_map>
-#include <algorithm>
 
-template<typename T, typename Compare = std::less<T>>
-class Heap {
-private:
-    std::vector<T> heap;
-    Compare comp;
-    
-    int parent(int i) { return (i - 1) / 2; }
-    int leftChild(int i) { return 2 * i + 1; }
-    int rightChild(int i) { return 2 * i + 2; }
-    
-    void siftUp(int i) {
-        while (i > 0 && comp(heap[i], heap[parent(i)])) {
-            std::swap(heap[i], heap[parent(i)]);
-            i = parent(i);
-        }
-    }
-    
-    void siftDown(int i) {
-        int best = i;
-        int left = leftChild(i);
-        int right = rightChild(i);
-        
-        if (left < heap.size() && comp(heap[left], heap[best])) {
-            best = left;
-        }
-        if (right < heap.size() && comp(heap[right], heap[best])) {
-            best = right;
-        }
-        
-        if (best != i) {
-            std::swap(heap[i], heap[best]);
-            siftDown(best);
-        }
-    }
-
-public:
-    void push(T val) {
-        heap.push_back(val);
-        siftUp(heap.size() - 1);
-    }
-    
-    T top() const {
-        return heap[0];
-    }
-    
-    void pop() {
-        heap[0] = heap.back();
-        heap.pop_back();
-        if (!heap.empty()) siftDown(0);
-    }
-    
-    int size() const { return heap.size(); }
-    bool empty() const { return heap.empty(); }
-};
-
-// Find Median from Data Stream
-class MedianFinder {
-private:
-    std::priority_queue<int> maxHeap;  // Lower half
-    std::priority_queue<int, std::vector<int>, std::greater<int>> minHeap;  // Upper half
-
-public:
-    void addNum(int num) {
-        maxHeap.push(num);
-        minHeap.push(maxHeap.top());
-        maxHeap.pop();
-        
-        if (minHeap.size() > maxHeap.size()) {
-            maxHeap.push(minHeap.top());
-            minHeap.pop();
-        }
-    }
-    
-    double findMedian() {
-        if (maxHeap.size() > minHeap.size()) {
-            return maxHeap.top();
-        }
-        return (maxHeap.top() + minHeap.top()) / 2.0;
-    }
-};
-
-// Top K Frequent Elements
-std::vector<int> topKFrequent(std::vector<int>& nums, int k) {
-    std::unordered_map<int, int> freq;
-    for (int num : nums) freq[num]++;
-    
-    auto cmp = [&freq](int a, int b) { return freq[a] > freq[b]; };
-    std::priority_queue<int, std::vector<int>, decltype(cmp)> minHeap(cmp);
-    
-    for (auto& [num, count] : freq) {
-        minHeap.push(num);
-        if (minHeap.size() > k) minHeap.pop();
-    }
-    
-    std::vector<int> result;
-    while (!minHeap.empty()) {
-        result.push_back(minHeap.top());
-        minHeap.pop();
-    }
-    return result;
-}
-
-// Kth Largest Element
-int findKthLargest(std::vector<int>& nums, int k) {
-    std::priority_queue<int, std::vector<int>, std::greater<int>> minHeap;
-    for (int num : nums) {
-        minHeap.push(num);
-        if (minHeap.size() > k) minHeap.pop();
-    }
-    return minHeap.top();
-}
+#include "Heap.h"
 
 int main() {
     // Custom Heap
@@ -135,6 +21,33 @@ int main() {
     }
     std::cout << std::endl;
     
+    // 4-ary max heap with emplace
+    DaryHeap<std::pair<int, std::string>, 4, std::greater<>> taskHeap;
+    taskHeap.emplace(2, "write");
+    taskHeap.emplace(9, "deploy");
+    taskHeap.emplace(5, "review");
+    std::cout << "4-ary max heap extraction: ";
+    while (!taskHeap.empty()) {
+        std::cout << taskHeap.top().second << " ";  // deploy review write
+        taskHeap.pop();
+    }
+    std::cout << std::endl;
+    
+    // Indexed heap with decrease-key
+    IndexedDaryHeap<int> indexed(4);
+    indexed.push(0, 40);
+    indexed.push(1, 10);
+    indexed.push(2, 30);
+    indexed.decreaseKey(2, 5);       // id 2 now has the smallest priority
+    indexed.pushOrDecrease(3, 20);
+    indexed.pushOrDecrease(0, 50);   // Not an improvement, ignored
+    std::cout << "Indexed heap ids by priority: ";
+    while (!indexed.empty()) {
+        std::cout << indexed.topId() << "(" << indexed.topPriority() << ") ";  // 2(5) 1(10) 3(20) 0(40)
+        indexed.pop();
+    }
+    std::cout << std::endl;
+    
     // Median Finder
     std::cout << "\n--- Median Finder ---\n";
     MedianFinder mf;
@@ -144,6 +57,31 @@ int main() {
     mf.addNum(3);
     std::cout << "Median after [1,2,3]: " << mf.findMedian() << std::endl;
     
+    std::cout << "Sliding median (k=3): ";
+    for (double m : medianSlidingWindow({1, 3, -1, -3, 5, 3, 6, 7}, 3)) std::cout << m << " ";
+    std::cout << std::endl;  // 1 -1 -1 3 5 6
+    
+    std::vector<long long> buckets = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000};  // Latency bounds, ms
+    OrderStatisticWindow<long long> p99(buckets, true);  // Raw latencies land in their bucket
+    for (long long ms : {7, 12, 10, 23, 480, 3, 6}) p99.add(ms);
+    p99.remove(480);
+    std::cout << "Window p50/p99: " << p99.quantile(0.5) << "/" << p99.quantile(0.99) << std::endl;  // 5/10
+    try {
+        OrderStatisticWindow<long long>(buckets).quantile(0.5);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Empty window: " << e.what() << std::endl;
+    }
+    
+    // Selection
+    std::cout << "\n--- Selection ---\n";
+    std::vector<int> values = {3, 2, 1, 5, 6, 4};
+    std::cout << "2nd largest (introselect): " << findKthLargestSelect(values, 2) << std::endl; // 5
+    std::vector<double> latencies;
+    for (int i = 1; i <= 1000; i++) latencies.push_back(i * 0.5);
+    std::cout << "p50/p90/p99: ";
+    for (double x : selectQuantiles(latencies, {0.5, 0.9, 0.99})) std::cout << x << " ";  // 250 450 495
+    std::cout << std::endl;
+    
     // Top K Frequent
     std::cout << "\n--- Top K Frequent ---\n";
     std::vector<int> nums = {1, 1, 1, 2, 2, 3};
@@ -152,5 +90,18 @@ int main() {
     for (int x : result) std::cout << x << " ";
     std::cout << std::endl;
     
+    ThreadPool pool(4);
+    std::cout << "Parallel top 2: ";
+    for (int x : topKFrequentParallel(nums, 2, pool)) std::cout << x << " ";  // 1 2
+    std::cout << std::endl;
+    
+    SpaceSaving<std::string> heavy(3);
+    for (const char* word : {"a", "b", "a", "c", "d", "a", "b", "e", "a"}) heavy.offer(word);
+    std::cout << "Space-Saving top 2: ";
+    for (auto& counter : heavy.topK(2)) {
+        std::cout << counter.key << "(" << counter.count << ", err " << counter.error << ") ";
+    }
+    std::cout << std::endl;  // a(4, err 0) ...
+    
     return 0;
 }
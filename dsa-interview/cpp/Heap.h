@@ -0,0 +1,654 @@
+/**
+ * Heap / Priority Queue Implementation in C++
+ * 
+ * Shared by Heap.cpp and the bench/ suite.
+ */
+
+#ifndef DSA_HEAP_H
+#define DSA_HEAP_H
+
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <algorithm>
+#include <string>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <array>
+#include <random>
+#include <type_traits>
+#include <stdexcept>
+
+#include "BinaryIndexedTree.h"
+#include "DaryHeap.h"
+#include "ThreadPool.h"
+
+template<typename T, typename Compare = std::less<T>>
+class Heap {
+private:
+    std::vector<T> heap;
+    Compare comp;
+    
+    int parent(int i) { return (i - 1) / 2; }
+    int leftChild(int i) { return 2 * i + 1; }
+    int rightChild(int i) { return 2 * i + 2; }
+    
+    void siftUp(int i) {
+        while (i > 0 && comp(heap[i], heap[parent(i)])) {
+            std::swap(heap[i], heap[parent(i)]);
+            i = parent(i);
+        }
+    }
+    
+    void siftDown(int i) {
+        int best = i;
+        int left = leftChild(i);
+        int right = rightChild(i);
+        
+        if (left < heap.size() && comp(heap[left], heap[best])) {
+            best = left;
+        }
+        if (right < heap.size() && comp(heap[right], heap[best])) {
+            best = right;
+        }
+        
+        if (best != i) {
+            std::swap(heap[i], heap[best]);
+            siftDown(best);
+        }
+    }
+
+public:
+    void push(T val) {
+        heap.push_back(val);
+        siftUp(heap.size() - 1);
+    }
+    
+    T top() const {
+        return heap[0];
+    }
+    
+    void pop() {
+        heap[0] = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) siftDown(0);
+    }
+    
+    int size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+};
+
+// Find Median from Data Stream
+class MedianFinder {
+private:
+    std::priority_queue<int> maxHeap;  // Lower half
+    std::priority_queue<int, std::vector<int>, std::greater<int>> minHeap;  // Upper half
+
+public:
+    void addNum(int num) {
+        maxHeap.push(num);
+        minHeap.push(maxHeap.top());
+        maxHeap.pop();
+        
+        if (minHeap.size() > maxHeap.size()) {
+            maxHeap.push(minHeap.top());
+            minHeap.pop();
+        }
+    }
+    
+    double findMedian() {
+        if (maxHeap.size() > minHeap.size()) {
+            return maxHeap.top();
+        }
+        return ((double)maxHeap.top() + minHeap.top()) / 2.0;  // Widen first: int sum can overflow
+    }
+};
+
+// ==================== Windowed Median / Quantiles ====================
+// Multiset over a fixed value domain with add, remove and rank queries in
+// O(log n): values are compressed to their index in the sorted domain and
+// counted in a Fenwick tree, and the k-th smallest is one lowerBound
+// descent. With the window's own values as the domain, results are exact and
+// adding a value outside it throws std::out_of_range. With bucketed = true
+// the domain holds bucket lower bounds (e.g. latency histogram edges): any
+// value counts toward the bucket [bound, next bound), values below the first
+// bound go to the first bucket, and quantiles report a bucket's lower bound.
+template<typename T>
+class OrderStatisticWindow {
+private:
+    std::vector<T> domain;  // Sorted, unique
+    BinaryIndexedTree<int> counts;
+    int total;
+    bool bucketed;
+    
+    int indexOf(const T& value) const {
+        if (bucketed) {
+            auto it = std::upper_bound(domain.begin(), domain.end(), value);
+            return it == domain.begin() ? 0 : (int)(it - domain.begin()) - 1;
+        }
+        auto it = std::lower_bound(domain.begin(), domain.end(), value);
+        if (it == domain.end() || value < *it) {
+            throw std::out_of_range("Value is not in the window's domain");
+        }
+        return it - domain.begin();
+    }
+    
+    void requireNonEmpty() const {
+        if (total == 0) throw std::out_of_range("Window is empty");
+    }
+    
+    static std::vector<T> sortedUnique(std::vector<T> values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        return values;
+    }
+
+public:
+    explicit OrderStatisticWindow(std::vector<T> values, bool bucketed = false)
+        : domain(sortedUnique(std::move(values))), counts(domain.size()), total(0), bucketed(bucketed) {
+        if (bucketed && domain.empty()) throw std::invalid_argument("Bucketed window needs at least one bound");
+    }
+    
+    void add(const T& value) {
+        counts.update(indexOf(value), 1);
+        total++;
+    }
+    
+    // Removes one occurrence (one count from value's bucket when bucketed);
+    // returns false if there is none
+    bool remove(const T& value) {
+        int i = indexOf(value);
+        if (counts.rangeSum(i, i) == 0) return false;
+        counts.update(i, -1);
+        total--;
+        return true;
+    }
+    
+    int size() const { return total; }
+    bool empty() const { return total == 0; }
+    
+    // k-th smallest, 0-indexed; requires k < size()
+    const T& kth(int k) const { return domain[counts.lowerBound(k + 1)]; }
+    
+    // Same rank rule as selectQuantiles: floor(q * (size - 1)). Throws
+    // std::out_of_range on an empty window, as does median().
+    const T& quantile(double q) const {
+        requireNonEmpty();
+        q = std::min(std::max(q, 0.0), 1.0);
+        return kth((int)(q * (total - 1)));
+    }
+    
+    // Mean of the two middle values for even sizes, computed in double
+    double median() const {
+        requireNonEmpty();
+        if (total % 2 == 1) return kth(total / 2);
+        return ((double)kth(total / 2 - 1) + (double)kth(total / 2)) / 2.0;
+    }
+};
+
+// Sliding Window Median (Leetcode 480)
+inline std::vector<double> medianSlidingWindow(const std::vector<int>& nums, int k) {
+    std::vector<double> result;
+    if (k <= 0 || (int)nums.size() < k) return result;
+    
+    OrderStatisticWindow<int> window(nums);
+    for (int i = 0; i < (int)nums.size(); i++) {
+        window.add(nums[i]);
+        if (i >= k) window.remove(nums[i - k]);
+        if (i >= k - 1) result.push_back(window.median());
+    }
+    return result;
+}
+
+// Top K Frequent Elements
+inline std::vector<int> topKFrequent(std::vector<int>& nums, int k) {
+    std::unordered_map<int, int> freq;
+    for (int num : nums) freq[num]++;
+    
+    // {count, num}: comparisons read the pair instead of probing freq
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> minHeap;
+    
+    for (auto& [num, count] : freq) {
+        minHeap.push({count, num});
+        if (minHeap.size() > static_cast<size_t>(k)) minHeap.pop();
+    }
+    
+    std::vector<int> result;
+    while (!minHeap.empty()) {
+        result.push_back(minHeap.top().second);
+        minHeap.pop();
+    }
+    return result;
+}
+
+// ==================== Parallel Top K Frequent ====================
+namespace detail {
+
+// (count, key) ordered by count descending, then key ascending
+inline bool moreFrequent(const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+}
+
+inline void keepTopK(std::vector<std::pair<int, int>>& counts, int k) {
+    if ((int)counts.size() > k) {
+        std::nth_element(counts.begin(), counts.begin() + k, counts.end(), moreFrequent);
+        counts.resize(k);
+    }
+}
+
+}  // namespace detail
+
+// Each worker counts its chunks into thread-local maps split into one
+// partition per worker by key hash; partition p is then merged and reduced
+// to its top k by one thread, so the merge is parallel as well. Selection
+// uses nth_element on (count, key) pairs, never hashing in a comparison.
+// Result is ordered by count descending, ties by key.
+inline std::vector<int> topKFrequentParallel(const std::vector<int>& nums, int k, ThreadPool& pool) {
+    const size_t partitions = pool.size();
+    auto partitionOf = [&](int key) {
+        return (size_t)(((uint64_t)((uint32_t)key * 2654435761u) * partitions) >> 32);
+    };
+    
+    std::vector<std::unordered_map<int, int>> local(pool.size() * partitions);  // [worker][partition]
+    pool.parallelFor(nums.size(), 1 << 16, [&](size_t lo, size_t hi, unsigned worker) {
+        std::unordered_map<int, int>* maps = &local[worker * partitions];
+        for (size_t i = lo; i < hi; i++) maps[partitionOf(nums[i])][nums[i]]++;
+    });
+    
+    std::vector<std::vector<std::pair<int, int>>> partial(partitions);
+    pool.parallelFor(partitions, 1, [&](size_t lo, size_t hi, unsigned) {
+        for (size_t p = lo; p < hi; p++) {
+            std::unordered_map<int, int>& merged = local[p];
+            for (size_t w = 1; w < pool.size(); w++) {
+                for (auto& [key, count] : local[w * partitions + p]) merged[key] += count;
+            }
+            partial[p].reserve(merged.size());
+            for (auto& [key, count] : merged) partial[p].push_back({count, key});
+            detail::keepTopK(partial[p], k);
+        }
+    });
+    
+    std::vector<std::pair<int, int>> candidates;
+    for (auto& part : partial) candidates.insert(candidates.end(), part.begin(), part.end());
+    detail::keepTopK(candidates, k);
+    std::sort(candidates.begin(), candidates.end(), detail::moreFrequent);
+    
+    std::vector<int> result;
+    for (auto& [count, key] : candidates) result.push_back(key);
+    return result;
+}
+
+// ==================== Space-Saving Heavy Hitters ====================
+// Bounded-memory streaming top-k (Metwally et al.): at most `capacity`
+// counters. An unseen key takes over the smallest counter and inherits its
+// count as error, so for every reported key
+//   count - error <= true frequency <= count,
+// and any key with true frequency > n / capacity is always reported.
+// Counters sit in a min-heap of slot ids, so offer() is O(log capacity).
+template<typename Key, typename Hash = std::hash<Key>>
+class SpaceSaving {
+public:
+    struct Counter {
+        Key key;
+        uint64_t count;
+        uint64_t error;
+    };
+
+private:
+    size_t capacity;
+    std::vector<Counter> slots;
+    std::vector<int> heap;      // Slot ids, min count at heap[0]
+    std::vector<int> position;  // Slot id -> index in heap
+    std::unordered_map<Key, int, Hash> slotOf;
+    
+    void siftUp(int i) {
+        int slot = heap[i];
+        while (i > 0 && slots[heap[(i - 1) / 2]].count > slots[slot].count) {
+            heap[i] = heap[(i - 1) / 2];
+            position[heap[i]] = i;
+            i = (i - 1) / 2;
+        }
+        heap[i] = slot;
+        position[slot] = i;
+    }
+    
+    void siftDown(int i) {
+        int slot = heap[i];
+        const int n = heap.size();
+        while (true) {
+            int child = 2 * i + 1;
+            if (child >= n) break;
+            if (child + 1 < n && slots[heap[child + 1]].count < slots[heap[child]].count) child++;
+            if (slots[heap[child]].count >= slots[slot].count) break;
+            heap[i] = heap[child];
+            position[heap[i]] = i;
+            i = child;
+        }
+        heap[i] = slot;
+        position[slot] = i;
+    }
+
+public:
+    explicit SpaceSaving(size_t capacity) : capacity(std::max<size_t>(capacity, 1)) {
+        slots.reserve(this->capacity);
+        heap.reserve(this->capacity);
+        position.reserve(this->capacity);
+        slotOf.reserve(this->capacity);
+    }
+    
+    void offer(const Key& key, uint64_t weight = 1) {
+        auto it = slotOf.find(key);
+        if (it != slotOf.end()) {
+            slots[it->second].count += weight;
+            siftDown(position[it->second]);
+            return;
+        }
+        
+        if (slots.size() < capacity) {
+            int slot = slots.size();
+            slots.push_back(Counter{key, weight, 0});
+            slotOf.emplace(key, slot);
+            heap.push_back(slot);
+            position.push_back(heap.size() - 1);
+            siftUp(heap.size() - 1);
+            return;
+        }
+        
+        int slot = heap[0];
+        Counter& victim = slots[slot];
+        slotOf.erase(victim.key);
+        victim.error = victim.count;
+        victim.count += weight;
+        victim.key = key;
+        slotOf.emplace(key, slot);
+        siftDown(0);
+    }
+    
+    // Largest counters first
+    std::vector<Counter> topK(size_t k) const {
+        std::vector<Counter> result(slots);
+        auto larger = [](const Counter& a, const Counter& b) { return a.count > b.count; };
+        k = std::min(k, result.size());
+        std::partial_sort(result.begin(), result.begin() + k, result.end(), larger);
+        result.resize(k);
+        return result;
+    }
+    
+    size_t size() const { return slots.size(); }
+};
+
+// Kth Largest Element
+inline int findKthLargest(std::vector<int>& nums, int k) {
+    std::priority_queue<int, std::vector<int>, std::greater<int>> minHeap;
+    for (int num : nums) {
+        minHeap.push(num);
+        if (minHeap.size() > k) minHeap.pop();
+    }
+    return minHeap.top();
+}
+
+// ==================== Selection (Introselect) ====================
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace detail {
+
+// Two-way partitions used by selectKth; both return how many elements
+// moved to the front. notAbove is the "<= pivot" half of a three-way split.
+template<typename T>
+struct ScalarPartition {
+    size_t below(T* data, size_t n, const T& pivot) {
+        return std::partition(data, data + n, [&](const T& x) { return x < pivot; }) - data;
+    }
+    size_t notAbove(T* data, size_t n, const T& pivot) {
+        return std::partition(data, data + n, [&](const T& x) { return !(pivot < x); }) - data;
+    }
+};
+
+// int32 partition for SIMD builds: elements below the bound are compacted
+// in place (the write cursor never passes the block just loaded), the rest
+// spill into a side buffer that is copied back behind them. AVX-512 uses
+// compress stores; AVX2 left-packs each 8-lane block with a 256-entry
+// permutation table indexed by the compare mask.
+class Int32Partition {
+private:
+    std::vector<int> spill;
+    
+#if defined(__AVX2__) && !defined(__AVX512F__)
+    static const int32_t* leftPackTable() {
+        alignas(32) static int32_t table[256][8];
+        static bool built = [] {
+            for (int mask = 0; mask < 256; mask++) {
+                int out = 0;
+                for (int lane = 0; lane < 8; lane++) {
+                    if (mask >> lane & 1) table[mask][out++] = lane;
+                }
+                while (out < 8) table[mask][out++] = 0;
+            }
+            return true;
+        }();
+        (void)built;
+        return &table[0][0];
+    }
+#endif
+    
+    size_t belowBound(int* data, size_t n, int bound) {
+        if (spill.size() < n + 16) spill.resize(n + 16);
+        int* rest = spill.data();
+        size_t lo = 0, spilled = 0, i = 0;
+#if defined(__AVX512F__)
+        const __m512i b = _mm512_set1_epi32(bound);
+        for (; i + 16 <= n; i += 16) {
+            __m512i v = _mm512_loadu_si512(data + i);
+            __mmask16 less = _mm512_cmplt_epi32_mask(v, b);
+            _mm512_mask_compressstoreu_epi32(data + lo, less, v);
+            _mm512_mask_compressstoreu_epi32(rest + spilled, (__mmask16)~less, v);
+            int count = __builtin_popcount(less);
+            lo += count;
+            spilled += 16 - count;
+        }
+#elif defined(__AVX2__)
+        const int32_t* table = leftPackTable();
+        const __m256i b = _mm256_set1_epi32(bound);
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            int less = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b, v)));
+            __m256i lessLanes = _mm256_load_si256(reinterpret_cast<const __m256i*>(table + less * 8));
+            __m256i restLanes = _mm256_load_si256(reinterpret_cast<const __m256i*>(table + (~less & 0xFF) * 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + lo), _mm256_permutevar8x32_epi32(v, lessLanes));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(rest + spilled), _mm256_permutevar8x32_epi32(v, restLanes));
+            int count = __builtin_popcount(less);
+            lo += count;
+            spilled += 8 - count;
+        }
+#endif
+        for (; i < n; i++) {
+            int x = data[i];
+            if (x < bound) data[lo++] = x;
+            else rest[spilled++] = x;
+        }
+        std::copy(rest, rest + spilled, data + lo);
+        return lo;
+    }
+
+public:
+    size_t below(int* data, size_t n, int pivot) { return belowBound(data, n, pivot); }
+    size_t notAbove(int* data, size_t n, int pivot) {
+        return pivot == INT32_MAX ? n : belowBound(data, n, pivot + 1);
+    }
+};
+
+// Floyd-Rivest selection with a three-way split and an introspective
+// depth limit. Large ranges take their pivot by recursively selecting
+// inside a sample window around k, sized so the pivot lands just past the
+// k-th element with high probability; small ones use median-of-three.
+// Leaves data with std::nth_element's postcondition.
+template<typename T, typename Partition>
+void floydRivestSelect(T* data, size_t n, size_t k, Partition& partition, int depth) {
+    while (n > 32) {
+        if (depth-- == 0) {
+            std::nth_element(data, data + k, data + n);
+            return;
+        }
+        
+        T pivot;
+        if (n > 600) {
+            double z = std::log((double)n);
+            double s = 0.5 * std::exp(2 * z / 3);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (k < n / 2 ? -1 : 1);
+            size_t left = (size_t)std::max(0.0, k - k * s / n + sd);
+            size_t right = (size_t)std::min((double)n - 1, k + (n - k) * s / n + sd);
+            floydRivestSelect(data + left, right - left + 1, k - left, partition, depth);
+            pivot = data[k];
+        } else {
+            T a = data[0], b = data[n / 2], c = data[n - 1];
+            pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+        }
+        
+        size_t less = partition.below(data, n, pivot);
+        if (k < less) {
+            n = less;
+            continue;
+        }
+        size_t equal = partition.notAbove(data + less, n - less, pivot);
+        if (k < less + equal) return;
+        data += less + equal;
+        k -= less + equal;
+        n -= less + equal;
+    }
+    std::nth_element(data, data + k, data + n);
+}
+
+template<typename T>
+void selectRange(T* data, size_t n, size_t k) {
+    int depth = 2 * (64 - __builtin_clzll(n | 1));
+#if defined(__AVX2__) || defined(__AVX512F__)
+    constexpr bool simd = std::is_same<T, int>::value;
+#else
+    constexpr bool simd = false;  // The spill pass only pays off when vectorized
+#endif
+    if constexpr (simd) {
+        Int32Partition partition;
+        floydRivestSelect(data, n, k, partition, depth);
+    } else {
+        ScalarPartition<T> partition;
+        floydRivestSelect(data, n, k, partition, depth);
+    }
+}
+
+template<typename T>
+void multiSelect(T* data, size_t n, const size_t* ranks, size_t count) {
+    if (count == 0 || n == 0) return;
+    size_t mid = count / 2;
+    size_t r = ranks[mid];
+    selectRange(data, n, r);
+    // Equal ranks below mid are already in place
+    size_t leftCount = std::lower_bound(ranks, ranks + mid, r) - ranks;
+    multiSelect(data, r, ranks, leftCount);
+    size_t rightStart = std::upper_bound(ranks + mid, ranks + count, r) - ranks;
+    std::vector<size_t> shifted(ranks + rightStart, ranks + count);
+    for (size_t& x : shifted) x -= r + 1;
+    multiSelect(data + r + 1, n - r - 1, shifted.data(), shifted.size());
+}
+
+}  // namespace detail
+
+// k-th smallest (0-indexed) in place, with std::nth_element's postcondition
+template<typename T>
+T selectKth(std::vector<T>& values, size_t k) {
+    detail::selectRange(values.data(), values.size(), k);
+    return values[k];
+}
+
+// Kth Largest Element by selection: O(n) expected instead of O(n log k)
+inline int findKthLargestSelect(std::vector<int>& nums, int k) {
+    return selectKth(nums, nums.size() - k);
+}
+
+// Several order statistics in one multi-select pass: the middle rank is
+// selected first and the others recurse into its two sides, O(n log q).
+// Quantile q maps to rank floor(q * (n - 1)). values is reordered.
+template<typename T>
+std::vector<T> selectQuantiles(std::vector<T>& values, const std::vector<double>& quantiles) {
+    const size_t n = values.size();
+    std::vector<T> result;
+    if (n == 0) return result;
+    
+    std::vector<size_t> ranks;
+    for (double q : quantiles) {
+        ranks.push_back((size_t)(std::min(std::max(q, 0.0), 1.0) * (n - 1)));
+    }
+    std::vector<size_t> sorted = ranks;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    detail::multiSelect(values.data(), n, sorted.data(), sorted.size());
+    
+    for (size_t r : ranks) result.push_back(values[r]);
+    return result;
+}
+
+// Parallel selection for large inputs, leaving values untouched. Each
+// round draws a random sample, brackets k's expected position between two
+// sample elements, counts the three bands in parallel and gathers only the
+// band holding k, which shrinks n by about sqrt(sample) per round. Small
+// remainders finish with selectKth.
+template<typename T>
+T parallelSelectKth(const std::vector<T>& values, size_t k, ThreadPool& pool) {
+    const size_t sampleSize = 1 << 12;
+    const size_t grain = 1 << 16;
+    std::mt19937_64 rng(values.size());
+    std::vector<T> current, next;
+    const T* data = values.data();
+    size_t n = values.size();
+    
+    while (n > 4 * grain) {
+        std::vector<T> sample(sampleSize);
+        for (T& x : sample) x = data[rng() % n];
+        std::sort(sample.begin(), sample.end());
+        double expected = (double)k * sampleSize / n;
+        double delta = 2 * std::sqrt((double)sampleSize);
+        const T lo = sample[(size_t)std::max(0.0, expected - delta)];
+        const T hi = sample[(size_t)std::min(sampleSize - 1.0, expected + delta)];
+        
+        // Bands: 0 = below lo, 1 = [lo, hi], 2 = above hi
+        auto band = [&](const T& x) { return x < lo ? 0 : (hi < x ? 2 : 1); };
+        const size_t chunks = (n + grain - 1) / grain;
+        std::vector<std::array<size_t, 3>> counts(chunks, {0, 0, 0});
+        pool.parallelFor(n, grain, [&](size_t begin, size_t end, unsigned) {
+            std::array<size_t, 3>& c = counts[begin / grain];
+            for (size_t i = begin; i < end; i++) c[band(data[i])]++;
+        });
+        
+        size_t below = 0, middle = 0;
+        for (auto& c : counts) {
+            below += c[0];
+            middle += c[1];
+        }
+        int target = k < below ? 0 : (k < below + middle ? 1 : 2);
+        if (target == 1 && !(lo < hi)) return lo;
+        if (target == 1) k -= below;
+        if (target == 2) k -= below + middle;
+        
+        std::vector<size_t> offset(chunks + 1, 0);
+        for (size_t c = 0; c < chunks; c++) offset[c + 1] = offset[c] + counts[c][target];
+        if (offset[chunks] == n) break;  // No progress (few distinct values)
+        
+        next.resize(offset[chunks]);
+        pool.parallelFor(n, grain, [&](size_t begin, size_t end, unsigned) {
+            size_t out = offset[begin / grain];
+            for (size_t i = begin; i < end; i++) {
+                if (band(data[i]) == target) next[out++] = data[i];
+            }
+        });
+        current.swap(next);
+        data = current.data();
+        n = current.size();
+    }
+    
+    if (data == values.data()) current.assign(values.begin(), values.end());
+    return selectKth(current, k);
+}
+
+#endif  // DSA_HEAP_H
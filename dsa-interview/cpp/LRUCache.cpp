@@ -6,214 +6,166 @@
  */
 
 #include <iostream>
-#include <unordered_map>
-#include <list>
 
-// ==================== LRU Cache ====================
-class LRUCache {
-private:
-    int capacity;
-    std::list<std::pair<int, int>> cache;  // {key, value}
-    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> map;
+#include "LRUCache.h"
 
-public:
-    LRUCache(int capacity) : capacity(capacity) {}
-    
-    int get(int key) {
-        if (map.find(key) == map.end()) {
-            return -1;
-        }
-        
-        // Move to front
-        cache.splice(cache.begin(), cache, map[key]);
-        return map[key]->second;
-    }
-    
-    void put(int key, int value) {
-        if (map.find(key) != map.end()) {
-            // Update existing
-            map[key]->second = value;
-            cache.splice(cache.begin(), cache, map[key]);
-        } else {
-            if (cache.size() >= capacity) {
-                // Evict LRU
-                int lruKey = cache.back().first;
-                cache.pop_back();
-                map.erase(lruKey);
-            }
-            
-            cache.push_front({key, value});
-            map[key] = cache.begin();
-        }
-    }
-};
-
-// ==================== LFU Cache ====================
-class LFUCache {
-private:
-    int capacity;
-    int minFreq;
-    
-    // key -> {value, freq}
-    std::unordered_map<int, std::pair<int, int>> keyToVal;
-    
-    // freq -> list of keys with that frequency (most recent at front)
-    std::unordered_map<int, std::list<int>> freqToKeys;
-    
-    // key -> iterator in freqToKeys[freq] list
-    std::unordered_map<int, std::list<int>::iterator> keyToIter;
-    
-    void updateFreq(int key) {
-        int freq = keyToVal[key].second;
-        
-        // Remove from current frequency list
-        freqToKeys[freq].erase(keyToIter[key]);
-        
-        // Update minFreq if necessary
-        if (freq == minFreq && freqToKeys[freq].empty()) {
-            minFreq++;
-        }
-        
-        // Add to new frequency list
-        keyToVal[key].second++;
-        int newFreq = keyToVal[key].second;
-        freqToKeys[newFreq].push_front(key);
-        keyToIter[key] = freqToKeys[newFreq].begin();
-    }
-
-public:
-    LFUCache(int capacity) : capacity(capacity), minFreq(0) {}
-    
-    int get(int key) {
-        if (keyToVal.find(key) == keyToVal.end()) {
-            return -1;
-        }
-        
-        updateFreq(key);
-        return keyToVal[key].first;
-    }
-    
-    void put(int key, int value) {
-        if (capacity == 0) return;
-        
-        if (keyToVal.find(key) != keyToVal.end()) {
-            keyToVal[key].first = value;
-            updateFreq(key);
-        } else {
-            if (keyToVal.size() >= capacity) {
-                // Evict LFU
-                int evictKey = freqToKeys[minFreq].back();
-                freqToKeys[minFreq].pop_back();
-                keyToVal.erase(evictKey);
-                keyToIter.erase(evictKey);
-            }
-            
-            keyToVal[key] = {value, 1};
-            freqToKeys[1].push_front(key);
-            keyToIter[key] = freqToKeys[1].begin();
-            minFreq = 1;
-        }
-    }
-};
-
-// ==================== TTL Cache (with expiration) ====================
-#include <chrono>
-
-class TTLCache {
-private:
-    struct CacheEntry {
-        int value;
-        std::chrono::steady_clock::time_point expiry;
-    };
-    
-    int capacity;
-    int ttlMs;  // Time to live in milliseconds
-    std::list<std::pair<int, CacheEntry>> cache;
-    std::unordered_map<int, std::list<std::pair<int, CacheEntry>>::iterator> map;
-    
-    bool isExpired(const CacheEntry& entry) {
-        return std::chrono::steady_clock::now() > entry.expiry;
-    }
-    
-    void evictExpired() {
-        while (!cache.empty() && isExpired(cache.back().second)) {
-            map.erase(cache.back().first);
-            cache.pop_back();
-        }
-    }
-
-public:
-    TTLCache(int capacity, int ttlMs) : capacity(capacity), ttlMs(ttlMs) {}
-    
-    int get(int key) {
-        evictExpired();
-        
-        if (map.find(key) == map.end()) {
-            return -1;
-        }
-        
-        auto it = map[key];
-        if (isExpired(it->second)) {
-            cache.erase(it);
-            map.erase(key);
-            return -1;
-        }
-        
-        // Move to front and refresh TTL
-        it->second.expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(ttlMs);
-        cache.splice(cache.begin(), cache, it);
-        return it->second.value;
-    }
-    
-    void put(int key, int value) {
-        evictExpired();
-        
-        auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(ttlMs);
-        
-        if (map.find(key) != map.end()) {
-            auto it = map[key];
-            it->second = {value, expiry};
-            cache.splice(cache.begin(), cache, it);
-        } else {
-            if (cache.size() >= capacity) {
-                map.erase(cache.back().first);
-                cache.pop_back();
-            }
-            
-            cache.push_front({key, {value, expiry}});
-            map[key] = cache.begin();
-        }
-    }
+// Clock the demo moves by hand, so hours of idle time take no real time
+struct ManualClock {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<ManualClock>;
+    static constexpr bool is_steady = true;
+    
+    static inline time_point current{};
+    static time_point now() { return current; }
 };
 
 int main() {
+    auto valueOr = [](const int* v) { return v ? *v : -1; };
+    
     // LRU Cache demo
     std::cout << "--- LRU Cache Demo ---" << std::endl;
-    LRUCache lruCache(2);
+    LRUCache<int, int> lruCache(2);
     
     lruCache.put(1, 1);
     lruCache.put(2, 2);
-    std::cout << "Get 1: " << lruCache.get(1) << std::endl;  // 1
+    std::cout << "Get 1: " << valueOr(lruCache.get(1)) << std::endl;  // 1
     
     lruCache.put(3, 3);  // Evicts key 2
-    std::cout << "Get 2: " << lruCache.get(2) << std::endl;  // -1
+    std::cout << "Get 2: " << valueOr(lruCache.get(2)) << std::endl;  // -1
     
     lruCache.put(4, 4);  // Evicts key 1
-    std::cout << "Get 1: " << lruCache.get(1) << std::endl;  // -1
-    std::cout << "Get 3: " << lruCache.get(3) << std::endl;  // 3
-    std::cout << "Get 4: " << lruCache.get(4) << std::endl;  // 4
+    std::cout << "Get 1: " << valueOr(lruCache.get(1)) << std::endl;  // -1
+    std::cout << "Get 3: " << valueOr(lruCache.get(3)) << std::endl;  // 3
+    std::cout << "Get 4: " << valueOr(lruCache.get(4)) << std::endl;  // 4
+    
+    lruCache.putMany({{5, 5}, {6, 6}});  // Evicts keys 3 and 4
+    std::cout << "GetMany [3, 5, 6]: ";
+    for (int* v : lruCache.getMany({3, 5, 6})) std::cout << valueOr(v) << " ";  // -1 5 6
+    std::cout << std::endl;
     
     // LFU Cache demo
     std::cout << "\n--- LFU Cache Demo ---" << std::endl;
-    LFUCache lfuCache(2);
+    LFUCache<int, int> lfuCache(2);
     
     lfuCache.put(1, 1);
     lfuCache.put(2, 2);
-    std::cout << "LFU Get 1: " << lfuCache.get(1) << std::endl;  // 1
+    std::cout << "LFU Get 1: " << valueOr(lfuCache.get(1)) << std::endl;  // 1
     
     lfuCache.put(3, 3);  // Evicts key 2 (LFU)
-    std::cout << "LFU Get 2: " << lfuCache.get(2) << std::endl;  // -1
-    std::cout << "LFU Get 3: " << lfuCache.get(3) << std::endl;  // 3
+    std::cout << "LFU Get 2: " << valueOr(lfuCache.get(2)) << std::endl;  // -1
+    std::cout << "LFU Get 3: " << valueOr(lfuCache.get(3)) << std::endl;  // 3
+    
+    // Generic keys/values: large values are moved in, lookups don't copy
+    LRUCache<std::string, std::string> sessions(2);
+    std::string payload(1024, 'x');
+    sessions.put("alice", std::move(payload));
+    sessions.put("bob", "short");
+    if (const std::string* v = sessions.get("alice")) {
+        std::cout << "Session alice: " << v->size() << " bytes" << std::endl;  // 1024
+    }
+    
+    // O(1) LFU Cache demo
+    ConstantLFUCache constLfu(2);
+    constLfu.put(1, 1);
+    constLfu.put(2, 2);
+    constLfu.get(1);
+    constLfu.put(3, 3);  // Evicts key 2 (LFU)
+    std::cout << "O(1) LFU Get 2: " << constLfu.get(2) << std::endl;  // -1
+    std::cout << "O(1) LFU Get 1: " << constLfu.get(1) << std::endl;  // 1
+    
+    // W-TinyLFU demo: a scan of one-hit wonders does not flush the hot set
+    std::cout << "\n--- W-TinyLFU Cache Demo ---" << std::endl;
+    TinyLFUCache tinyLfu(100);
+    for (int round = 0; round < 5; round++) {
+        for (int key = 0; key < 50; key++) {
+            if (tinyLfu.get(key) == -1) tinyLfu.put(key, key);
+        }
+    }
+    for (int key = 1000; key < 11000; key++) {
+        tinyLfu.put(key, key);
+    }
+    int hotHits = 0;
+    for (int key = 0; key < 50; key++) {
+        if (tinyLfu.get(key) != -1) hotHits++;
+    }
+    std::cout << "Hot keys retained after scan: " << hotHits << "/50" << std::endl;
+    
+    // Timing-wheel TTL Cache demo with per-key TTLs
+    std::cout << "\n--- Timing Wheel TTL Cache Demo ---" << std::endl;
+    TimingWheelTTLCache wheelCache(10, 5000);
+    wheelCache.put(1, 100, 50);  // Short-lived session
+    wheelCache.put(2, 200);      // Default 5s TTL
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    std::cout << "Wheel Get 1 (expired): " << wheelCache.get(1) << std::endl;  // -1
+    std::cout << "Wheel Get 2: " << wheelCache.get(2) << std::endl;            // 200
+    std::cout << "Wheel size: " << wheelCache.size() << std::endl;             // 1
+    
+    // An hour idle with 1ms ticks: advance() jumps between occupied slots
+    // instead of stepping 3.6M ticks
+    TimingWheelTTLCache<ManualClock> idleCache(10, 5000);
+    idleCache.put(1, 100, 3 * 3600 * 1000);  // 3h TTL
+    ManualClock::current += std::chrono::hours(1);
+    std::cout << "Wheel Get 1 after 1h idle: " << idleCache.get(1) << std::endl;  // 100, TTL refreshed
+    ManualClock::current += std::chrono::hours(3) + std::chrono::milliseconds(1);
+    std::cout << "Wheel Get 1 after 3h more: " << idleCache.get(1) << std::endl;  // -1
+    
+    // Slab LRU Cache demo
+    std::cout << "\n--- Slab LRU Cache Demo ---" << std::endl;
+    SlabLRUCache slabCache(2);
+    
+    slabCache.put(1, 1);
+    slabCache.put(2, 2);
+    std::cout << "Slab Get 1: " << slabCache.get(1) << std::endl;  // 1
+    
+    slabCache.put(3, 3);  // Evicts key 2, reusing its slab entry
+    std::cout << "Slab Get 2: " << slabCache.get(2) << std::endl;  // -1
+    std::cout << "Slab Get 3: " << slabCache.get(3) << std::endl;  // 3
+    
+    SlabTTLCache slabTtl(2, 1000);
+    slabTtl.put(1, 100);
+    std::cout << "Slab TTL Get 1: " << slabTtl.get(1) << std::endl;  // 100
+    
+    // Concurrent LRU Cache demo
+    std::cout << "\n--- Concurrent LRU Cache Demo ---" << std::endl;
+    ConcurrentLRUCache<int, int> concurrentCache(1000, 4);
+    
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&concurrentCache, t]() {
+            for (int i = 0; i < 10000; i++) {
+                int key = (i * 7 + t) % 2000;
+                if (!concurrentCache.get(key)) {
+                    concurrentCache.put(key, key * 10);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    
+    std::cout << "Size: " << concurrentCache.size() << std::endl;  // 1000
+    
+    // One lock acquisition per shard for the whole batch
+    concurrentCache.putMany({{5000, 1}, {5001, 2}, {5002, 3}});
+    auto batch = concurrentCache.getMany({5000, 5001, 5002, 9999});
+    std::cout << "GetMany hits: " << std::count_if(batch.begin(), batch.end(),
+        [](const std::optional<int>& v) { return v.has_value(); }) << "/4" << std::endl;  // 3/4
+    for (size_t i = 0; i < concurrentCache.shardCount(); i++) {
+        auto stats = concurrentCache.shardStats(i);
+        std::cout << "  Shard " << i << ": hits=" << stats.hits
+                  << " misses=" << stats.misses
+                  << " evictions=" << stats.evictions
+                  << " size=" << stats.size << std::endl;
+    }
+    
+    // Prometheus snapshot; counters only with -DDSA_STATS=1, gauges always
+    auto lruSource = stats::registry().add([&](stats::Exposition& out) {
+        stats::exportCache(out, {{"cache", "lru"}}, lruCache.stats());
+        stats::exportCache(out, {{"cache", "slab_ttl"}}, slabTtl.stats());  // Also has expirations, probes
+        stats::exportCache(out, {{"cache", "concurrent_lru"}}, concurrentCache.stats());
+    });
+    std::cout << "\n--- Stats Snapshot ---\n" << stats::registry().scrape();
     
     return 0;
 }
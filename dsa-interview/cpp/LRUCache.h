@@ -0,0 +1,1483 @@
+/**
+ * LRU & LFU Cache Implementation in C++
+ * 
+ * Time Complexity: O(1) for get and put
+ * Space Complexity: O(capacity)
+ * 
+ * Shared by LRUCache.cpp and the bench/ suite.
+ */
+
+#ifndef DSA_LRU_CACHE_H
+#define DSA_LRU_CACHE_H
+
+#include <string>
+#include <unordered_map>
+#include <list>
+#include <algorithm>
+#include <vector>
+
+#include "Stats.h"
+
+// Batch APIs issue prefetches a few keys ahead; no-op on other compilers
+#if defined(__GNUC__) || defined(__clang__)
+#define CACHE_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define CACHE_PREFETCH(addr) ((void)0)
+#endif
+
+// std::unordered_map has no way to hand out the address of its bucket array,
+// so the node caches prefetch the head node of a key's bucket instead.
+// begin(bucket(k)) reads the bucket slot and its predecessor link. Those loads
+// feed nothing but the prefetch, so they overlap across the batch instead of
+// stalling the find() in progress. Collision chains past the head node are
+// not prefetched.
+template<typename Map, typename Key>
+inline void prefetchBucket(const Map& map, const Key& key) {
+    size_t bucket = map.bucket(key);
+    auto head = map.begin(bucket);
+    if (head != map.end(bucket)) CACHE_PREFETCH(&*head);
+}
+
+// ==================== LRU Cache ====================
+#include <memory>
+#include <functional>
+
+// Caches are generic over key/value. Lookups return a pointer into the cache
+// (nullptr on miss) instead of copying the value; it stays valid until the
+// next put/eviction. All node containers share the rebound allocator.
+template<typename Key, typename Value,
+         typename Hash = std::hash<Key>,
+         typename Alloc = std::allocator<std::pair<Key, Value>>>
+class LRUCache {
+private:
+    template<typename T>
+    using Rebind = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    
+    using Entry = std::pair<Key, Value>;  // {key, value}
+    using List = std::list<Entry, Rebind<Entry>>;
+    using ListIter = typename List::iterator;
+    using Map = std::unordered_map<Key, ListIter, Hash, std::equal_to<Key>,
+                                   Rebind<std::pair<const Key, ListIter>>>;
+    
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+    
+    int capacity;
+    List cache;
+    Map map;
+    DSA_STAT(stats::CacheCounters counters;)
+    
+    template<typename V>
+    void putImpl(const Key& key, V&& value) {
+        auto it = map.find(key);
+        if (it != map.end()) {
+            // Update existing
+            it->second->second = std::forward<V>(value);
+            cache.splice(cache.begin(), cache, it->second);
+            return;
+        }
+        
+        if (static_cast<int>(cache.size()) >= capacity) {
+            // Evict LRU
+            map.erase(cache.back().first);
+            cache.pop_back();
+            DSA_STAT(counters.evictions.add();)
+        }
+        
+        cache.emplace_front(key, std::forward<V>(value));
+        map.emplace(key, cache.begin());
+    }
+    
+    // Puts change the index, so each bucket is prefetched PREFETCH_DISTANCE
+    // entries ahead and nothing is resolved up front
+    template<bool MOVE, typename Entries>
+    void putBatch(Entries& entries) {
+        if (capacity <= 0) return;
+        const size_t n = entries.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            prefetchBucket(map, entries[i].first);
+        }
+        
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) prefetchBucket(map, entries[i + PREFETCH_DISTANCE].first);
+            if constexpr (MOVE) {
+                putImpl(entries[i].first, std::move(entries[i].second));
+            } else {
+                putImpl(entries[i].first, entries[i].second);
+            }
+        }
+    }
+
+public:
+    explicit LRUCache(int capacity, const Hash& hash = Hash(), const Alloc& alloc = Alloc())
+        : capacity(capacity), cache(Rebind<Entry>(alloc)),
+          map(0, hash, std::equal_to<Key>(), Rebind<std::pair<const Key, ListIter>>(alloc)) {}
+    
+    Value* get(const Key& key) {
+        auto it = map.find(key);
+        if (it == map.end()) {
+            DSA_STAT(counters.misses.add();)
+            return nullptr;
+        }
+        
+        // Move to front
+        DSA_STAT(counters.hits.add();)
+        cache.splice(cache.begin(), cache, it->second);
+        return &it->second->second;
+    }
+    
+    void put(const Key& key, const Value& value) {
+        if (capacity <= 0) return;
+        putImpl(key, value);
+    }
+    
+    void put(const Key& key, Value&& value) {
+        if (capacity <= 0) return;
+        putImpl(key, std::move(value));
+    }
+    
+    // Lookups don't change the index, so every key is resolved first, with
+    // its bucket prefetched PREFETCH_DISTANCE keys ahead and its list node
+    // prefetched once found. The recency moves are then applied in order.
+    std::vector<Value*> getMany(const std::vector<Key>& keys) {
+        const size_t n = keys.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            prefetchBucket(map, keys[i]);
+        }
+        
+        std::vector<ListIter> found(n, cache.end());
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) prefetchBucket(map, keys[i + PREFETCH_DISTANCE]);
+            auto it = map.find(keys[i]);
+            if (it != map.end()) {
+                found[i] = it->second;
+                CACHE_PREFETCH(&*found[i]);
+            }
+        }
+        
+        std::vector<Value*> result(keys.size(), nullptr);
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (found[i] == cache.end()) {
+                DSA_STAT(counters.misses.add();)
+                continue;
+            }
+            DSA_STAT(counters.hits.add();)
+            cache.splice(cache.begin(), cache, found[i]);
+            result[i] = &found[i]->second;
+        }
+        return result;
+    }
+    
+    void putMany(const std::vector<std::pair<Key, Value>>& entries) {
+        putBatch<false>(entries);
+    }
+    
+    // Moves the values in; the entries are left with moved-from values
+    void putMany(std::vector<std::pair<Key, Value>>&& entries) {
+        putBatch<true>(entries);
+    }
+    
+    // Hit/miss/eviction counts stay zero unless built with DSA_STATS
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), cache.size(), std::max(capacity, 0));
+    }
+};
+
+// ==================== LFU Cache ====================
+template<typename Key, typename Value,
+         typename Hash = std::hash<Key>,
+         typename Alloc = std::allocator<std::pair<Key, Value>>>
+class LFUCache {
+private:
+    template<typename T>
+    using Rebind = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    
+    using KeyList = std::list<Key, Rebind<Key>>;
+    using KeyIter = typename KeyList::iterator;
+    using ValueFreq = std::pair<Value, int>;
+    
+    int capacity;
+    int minFreq;
+    
+    // key -> {value, freq}
+    std::unordered_map<Key, ValueFreq, Hash, std::equal_to<Key>,
+                       Rebind<std::pair<const Key, ValueFreq>>> keyToVal;
+    
+    // freq -> list of keys with that frequency (most recent at front)
+    std::unordered_map<int, KeyList, std::hash<int>, std::equal_to<int>,
+                       Rebind<std::pair<const int, KeyList>>> freqToKeys;
+    
+    // key -> iterator in freqToKeys[freq] list
+    std::unordered_map<Key, KeyIter, Hash, std::equal_to<Key>,
+                       Rebind<std::pair<const Key, KeyIter>>> keyToIter;
+    
+    Alloc alloc;
+    DSA_STAT(stats::CacheCounters counters;)
+    
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+    
+    // A hit or put looks the key up in both keyToVal and keyToIter
+    void prefetch(const Key& key) const {
+        prefetchBucket(keyToVal, key);
+        prefetchBucket(keyToIter, key);
+    }
+    
+    KeyList& keysWithFreq(int freq) {
+        auto it = freqToKeys.find(freq);
+        if (it == freqToKeys.end()) {
+            it = freqToKeys.emplace(freq, KeyList(Rebind<Key>(alloc))).first;
+        }
+        return it->second;
+    }
+    
+    void updateFreq(const Key& key, ValueFreq& entry) {
+        int freq = entry.second;
+        auto iter = keyToIter.find(key);
+        
+        // Remove from current frequency list
+        KeyList& current = freqToKeys.find(freq)->second;
+        current.erase(iter->second);
+        
+        // Update minFreq if necessary
+        if (freq == minFreq && current.empty()) {
+            minFreq++;
+        }
+        
+        // Add to new frequency list
+        entry.second++;
+        KeyList& next = keysWithFreq(entry.second);
+        next.push_front(key);
+        iter->second = next.begin();
+    }
+    
+    template<typename V>
+    void putImpl(const Key& key, V&& value) {
+        auto it = keyToVal.find(key);
+        if (it != keyToVal.end()) {
+            it->second.first = std::forward<V>(value);
+            updateFreq(key, it->second);
+            return;
+        }
+        
+        if (static_cast<int>(keyToVal.size()) >= capacity) {
+            // Evict LFU
+            KeyList& lfu = freqToKeys.find(minFreq)->second;
+            keyToVal.erase(lfu.back());
+            keyToIter.erase(lfu.back());
+            lfu.pop_back();
+            DSA_STAT(counters.evictions.add();)
+        }
+        
+        keyToVal.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                         std::forward_as_tuple(std::forward<V>(value), 1));
+        KeyList& ones = keysWithFreq(1);
+        ones.push_front(key);
+        keyToIter.emplace(key, ones.begin());
+        minFreq = 1;
+    }
+    
+    template<bool MOVE, typename Entries>
+    void putBatch(Entries& entries) {
+        if (capacity <= 0) return;
+        const size_t n = entries.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            prefetch(entries[i].first);
+        }
+        
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) prefetch(entries[i + PREFETCH_DISTANCE].first);
+            if constexpr (MOVE) {
+                putImpl(entries[i].first, std::move(entries[i].second));
+            } else {
+                putImpl(entries[i].first, entries[i].second);
+            }
+        }
+    }
+
+public:
+    explicit LFUCache(int capacity, const Hash& hash = Hash(), const Alloc& alloc = Alloc())
+        : capacity(capacity), minFreq(0),
+          keyToVal(0, hash, std::equal_to<Key>(), Rebind<std::pair<const Key, ValueFreq>>(alloc)),
+          freqToKeys(0, std::hash<int>(), std::equal_to<int>(), Rebind<std::pair<const int, KeyList>>(alloc)),
+          keyToIter(0, hash, std::equal_to<Key>(), Rebind<std::pair<const Key, KeyIter>>(alloc)),
+          alloc(alloc) {}
+    
+    Value* get(const Key& key) {
+        auto it = keyToVal.find(key);
+        if (it == keyToVal.end()) {
+            DSA_STAT(counters.misses.add();)
+            return nullptr;
+        }
+        
+        DSA_STAT(counters.hits.add();)
+        updateFreq(key, it->second);
+        return &it->second.first;
+    }
+    
+    void put(const Key& key, const Value& value) {
+        if (capacity <= 0) return;
+        putImpl(key, value);
+    }
+    
+    void put(const Key& key, Value&& value) {
+        if (capacity <= 0) return;
+        putImpl(key, std::move(value));
+    }
+    
+    // Hits never insert into keyToVal, so its entries can be resolved up front.
+    // Both maps' buckets are prefetched PREFETCH_DISTANCE keys ahead.
+    std::vector<Value*> getMany(const std::vector<Key>& keys) {
+        const size_t n = keys.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            prefetch(keys[i]);
+        }
+        
+        std::vector<ValueFreq*> found(n, nullptr);
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) prefetch(keys[i + PREFETCH_DISTANCE]);
+            auto it = keyToVal.find(keys[i]);
+            if (it != keyToVal.end()) {
+                found[i] = &it->second;
+                CACHE_PREFETCH(found[i]);
+            }
+        }
+        
+        std::vector<Value*> result(keys.size(), nullptr);
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (!found[i]) {
+                DSA_STAT(counters.misses.add();)
+                continue;
+            }
+            DSA_STAT(counters.hits.add();)
+            updateFreq(keys[i], *found[i]);
+            result[i] = &found[i]->first;
+        }
+        return result;
+    }
+    
+    void putMany(const std::vector<std::pair<Key, Value>>& entries) {
+        putBatch<false>(entries);
+    }
+    
+    void putMany(std::vector<std::pair<Key, Value>>&& entries) {
+        putBatch<true>(entries);
+    }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), keyToVal.size(), std::max(capacity, 0));
+    }
+};
+
+// ==================== O(1) LFU Cache ====================
+// Frequency buckets form a doubly linked list in ascending frequency order and
+// every item points back to its bucket. A hit is one hash lookup plus a splice
+// into the neighbouring bucket; buckets are freed as soon as they empty, so
+// memory is bounded by the number of live entries.
+class ConstantLFUCache {
+private:
+    struct Bucket;
+    struct Item {
+        int key;
+        int value;
+        std::list<Bucket>::iterator bucket;
+    };
+    struct Bucket {
+        int freq;
+        std::list<Item> items;  // Most recent at front
+    };
+    
+    int capacity;
+    std::list<Bucket> buckets;  // Front is the minimum frequency
+    std::unordered_map<int, std::list<Item>::iterator> map;
+    DSA_STAT(stats::CacheCounters counters;)
+    
+    void touch(std::list<Item>::iterator item) {
+        auto bucket = item->bucket;
+        auto next = std::next(bucket);
+        if (next == buckets.end() || next->freq != bucket->freq + 1) {
+            next = buckets.insert(next, Bucket{bucket->freq + 1, {}});
+        }
+        
+        next->items.splice(next->items.begin(), bucket->items, item);
+        item->bucket = next;
+        if (bucket->items.empty()) {
+            buckets.erase(bucket);
+        }
+    }
+    
+    void evict() {
+        auto bucket = buckets.begin();
+        map.erase(bucket->items.back().key);
+        bucket->items.pop_back();
+        if (bucket->items.empty()) {
+            buckets.erase(bucket);
+        }
+        DSA_STAT(counters.evictions.add();)
+    }
+
+public:
+    ConstantLFUCache(int capacity) : capacity(capacity) {}
+    
+    int get(int key) {
+        auto it = map.find(key);
+        if (it == map.end()) {
+            DSA_STAT(counters.misses.add();)
+            return -1;
+        }
+        
+        DSA_STAT(counters.hits.add();)
+        touch(it->second);
+        return it->second->value;
+    }
+    
+    void put(int key, int value) {
+        if (capacity <= 0) return;
+        
+        auto it = map.find(key);
+        if (it != map.end()) {
+            it->second->value = value;
+            touch(it->second);
+            return;
+        }
+        
+        if (static_cast<int>(map.size()) >= capacity) {
+            evict();
+        }
+        
+        if (buckets.empty() || buckets.front().freq != 1) {
+            buckets.push_front(Bucket{1, {}});
+        }
+        auto bucket = buckets.begin();
+        bucket->items.push_front(Item{key, value, bucket});
+        map[key] = bucket->items.begin();
+    }
+    
+    bool contains(int key) const { return map.count(key) > 0; }
+    bool full() const { return static_cast<int>(map.size()) >= capacity; }
+    int getCapacity() const { return capacity; }
+    
+    // Key that the next insertion into a full cache would evict
+    int victimKey() const { return buckets.front().items.back().key; }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), map.size(), std::max(capacity, 0));
+    }
+};
+
+// ==================== W-TinyLFU Cache ====================
+#include <cstdint>
+#include <vector>
+
+// Count-min sketch of 4-bit-range counters. Every `sampleSize` increments all
+// counters are halved, so the estimate reflects recent popularity rather than
+// all-time counts.
+class FrequencySketch {
+private:
+    static const int DEPTH = 4;
+    static const uint8_t MAX_COUNT = 15;
+    
+    std::vector<uint8_t> table;  // DEPTH rows of `width` counters
+    uint32_t mask;
+    int additions;
+    int sampleSize;
+    
+    static uint32_t index(int key, int row) {
+        static const uint32_t seeds[DEPTH] = {0x9e3779b1U, 0x85ebca6bU, 0xc2b2ae35U, 0x27d4eb2fU};
+        uint32_t h = (static_cast<uint32_t>(key) + row) * seeds[row];
+        h ^= h >> 15;
+        h *= 0x2c1b3c6dU;
+        h ^= h >> 12;
+        return h;
+    }
+    
+    void reset() {
+        for (uint8_t& c : table) c >>= 1;
+        additions /= 2;
+    }
+
+public:
+    FrequencySketch(int capacity) : additions(0) {
+        uint32_t width = 16;
+        while (width < static_cast<uint32_t>(std::max(capacity, 1))) width <<= 1;
+        table.assign(DEPTH * width, 0);
+        mask = width - 1;
+        sampleSize = 10 * std::max(capacity, 1);
+    }
+    
+    void increment(int key) {
+        uint32_t width = mask + 1;
+        bool added = false;
+        for (int row = 0; row < DEPTH; row++) {
+            uint8_t& c = table[row * width + (index(key, row) & mask)];
+            if (c < MAX_COUNT) {
+                c++;
+                added = true;
+            }
+        }
+        if (added && ++additions >= sampleSize) {
+            reset();
+        }
+    }
+    
+    int estimate(int key) const {
+        uint32_t width = mask + 1;
+        int result = MAX_COUNT;
+        for (int row = 0; row < DEPTH; row++) {
+            result = std::min<int>(result, table[row * width + (index(key, row) & mask)]);
+        }
+        return result;
+    }
+};
+
+// A small LRU window (~1% of capacity) absorbs new keys. When it overflows,
+// its LRU entry only enters the LFU main region if the sketch says it is more
+// popular than the main region's victim, so one-hit wonders never displace
+// the hot set.
+class TinyLFUCache {
+private:
+    int windowCapacity;
+    std::list<std::pair<int, int>> window;  // {key, value}, most recent at front
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> windowMap;
+    ConstantLFUCache main;
+    FrequencySketch sketch;
+    DSA_STAT(stats::CacheCounters counters;)
+    
+    void admit(int key, int value) {
+        DSA_STAT(if (main.full()) counters.evictions.add();)  // The victim or the candidate leaves
+        if (!main.full()) {
+            main.put(key, value);
+        } else if (main.getCapacity() > 0 &&
+                   sketch.estimate(key) > sketch.estimate(main.victimKey())) {
+            main.put(key, value);  // Evicts the victim
+        }
+    }
+
+public:
+    TinyLFUCache(int capacity)
+        : windowCapacity(std::max(1, capacity / 100)),
+          main(std::max(0, capacity - std::max(1, capacity / 100))),
+          sketch(capacity) {
+        if (capacity <= 0) windowCapacity = 0;
+    }
+    
+    int get(int key) {
+        sketch.increment(key);
+        
+        auto it = windowMap.find(key);
+        if (it != windowMap.end()) {
+            DSA_STAT(counters.hits.add();)
+            window.splice(window.begin(), window, it->second);
+            return it->second->second;
+        }
+        int value = main.get(key);
+        DSA_STAT((value == -1 ? counters.misses : counters.hits).add();)
+        return value;
+    }
+    
+    void put(int key, int value) {
+        if (windowCapacity == 0) return;
+        sketch.increment(key);
+        
+        auto it = windowMap.find(key);
+        if (it != windowMap.end()) {
+            it->second->second = value;
+            window.splice(window.begin(), window, it->second);
+            return;
+        }
+        if (main.contains(key)) {
+            main.put(key, value);
+            return;
+        }
+        
+        window.push_front({key, value});
+        windowMap[key] = window.begin();
+        
+        if (static_cast<int>(window.size()) > windowCapacity) {
+            auto [candidateKey, candidateValue] = window.back();
+            window.pop_back();
+            windowMap.erase(candidateKey);
+            admit(candidateKey, candidateValue);
+        }
+    }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), window.size() + main.stats().size,
+                                              windowCapacity + main.getCapacity());
+    }
+};
+
+// ==================== TTL Cache (with expiration) ====================
+#include <chrono>
+
+template<typename Key, typename Value,
+         typename Hash = std::hash<Key>,
+         typename Alloc = std::allocator<std::pair<Key, Value>>>
+class TTLCache {
+private:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    
+    struct CacheEntry {
+        Value value;
+        TimePoint expiry;
+    };
+    
+    template<typename T>
+    using Rebind = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    
+    using Entry = std::pair<Key, CacheEntry>;
+    using List = std::list<Entry, Rebind<Entry>>;
+    using ListIter = typename List::iterator;
+    using Map = std::unordered_map<Key, ListIter, Hash, std::equal_to<Key>,
+                                   Rebind<std::pair<const Key, ListIter>>>;
+    
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+    
+    int capacity;
+    int ttlMs;  // Time to live in milliseconds
+    List cache;
+    Map map;
+    DSA_STAT(stats::CacheCounters counters;)
+    
+    bool isExpired(const CacheEntry& entry, TimePoint now) {
+        return now > entry.expiry;
+    }
+    
+    void evictExpired(TimePoint now) {
+        while (!cache.empty() && isExpired(cache.back().second, now)) {
+            map.erase(cache.back().first);
+            cache.pop_back();
+            DSA_STAT(counters.expirations.add();)
+        }
+    }
+    
+    Value* getAt(const Key& key, TimePoint now) {
+        evictExpired(now);
+        
+        auto found = map.find(key);
+        if (found == map.end()) {
+            DSA_STAT(counters.misses.add();)
+            return nullptr;
+        }
+        
+        auto it = found->second;
+        if (isExpired(it->second, now)) {
+            map.erase(found);
+            cache.erase(it);
+            DSA_STAT(counters.expirations.add(); counters.misses.add();)
+            return nullptr;
+        }
+        
+        // Move to front and refresh TTL
+        DSA_STAT(counters.hits.add();)
+        it->second.expiry = now + std::chrono::milliseconds(ttlMs);
+        cache.splice(cache.begin(), cache, it);
+        return &it->second.value;
+    }
+    
+    template<typename V>
+    void putAt(const Key& key, V&& value, TimePoint now) {
+        if (capacity <= 0) return;
+        evictExpired(now);
+        
+        auto expiry = now + std::chrono::milliseconds(ttlMs);
+        
+        auto found = map.find(key);
+        if (found != map.end()) {
+            auto it = found->second;
+            it->second.value = std::forward<V>(value);
+            it->second.expiry = expiry;
+            cache.splice(cache.begin(), cache, it);
+        } else {
+            if (static_cast<int>(cache.size()) >= capacity) {
+                map.erase(cache.back().first);
+                cache.pop_back();
+                DSA_STAT(counters.evictions.add();)
+            }
+            
+            cache.emplace_front(key, CacheEntry{std::forward<V>(value), expiry});
+            map.emplace(key, cache.begin());
+        }
+    }
+    
+    template<bool MOVE, typename Entries>
+    void putBatch(Entries& entries) {
+        auto now = std::chrono::steady_clock::now();
+        const size_t n = entries.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            prefetchBucket(map, entries[i].first);
+        }
+        
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) prefetchBucket(map, entries[i + PREFETCH_DISTANCE].first);
+            if constexpr (MOVE) {
+                putAt(entries[i].first, std::move(entries[i].second), now);
+            } else {
+                putAt(entries[i].first, entries[i].second, now);
+            }
+        }
+    }
+
+public:
+    TTLCache(int capacity, int ttlMs, const Hash& hash = Hash(), const Alloc& alloc = Alloc())
+        : capacity(capacity), ttlMs(ttlMs), cache(Rebind<Entry>(alloc)),
+          map(0, hash, std::equal_to<Key>(), Rebind<std::pair<const Key, ListIter>>(alloc)) {}
+    
+    Value* get(const Key& key) {
+        return getAt(key, std::chrono::steady_clock::now());
+    }
+    
+    void put(const Key& key, const Value& value) {
+        putAt(key, value, std::chrono::steady_clock::now());
+    }
+    
+    void put(const Key& key, Value&& value) {
+        putAt(key, std::move(value), std::chrono::steady_clock::now());
+    }
+    
+    // The whole batch is evaluated against a single clock reading. Every key
+    // shares one TTL and a touch moves its key to the front with a fresh
+    // expiry, so the recency list is also in expiry order: once evictExpired
+    // has run, nothing left is expired at `now`. The lookups are then resolved
+    // up front, like LRUCache::getMany.
+    std::vector<Value*> getMany(const std::vector<Key>& keys) {
+        auto now = std::chrono::steady_clock::now();
+        evictExpired(now);
+        
+        const size_t n = keys.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            prefetchBucket(map, keys[i]);
+        }
+        
+        std::vector<ListIter> found(n, cache.end());
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) prefetchBucket(map, keys[i + PREFETCH_DISTANCE]);
+            auto it = map.find(keys[i]);
+            if (it != map.end()) {
+                found[i] = it->second;
+                CACHE_PREFETCH(&*found[i]);
+            }
+        }
+        
+        auto expiry = now + std::chrono::milliseconds(ttlMs);
+        std::vector<Value*> result(n, nullptr);
+        for (size_t i = 0; i < n; i++) {
+            if (found[i] == cache.end()) {
+                DSA_STAT(counters.misses.add();)
+                continue;
+            }
+            DSA_STAT(counters.hits.add();)
+            found[i]->second.expiry = expiry;
+            cache.splice(cache.begin(), cache, found[i]);
+            result[i] = &found[i]->second.value;
+        }
+        return result;
+    }
+    
+    void putMany(const std::vector<std::pair<Key, Value>>& entries) {
+        putBatch<false>(entries);
+    }
+    
+    void putMany(std::vector<std::pair<Key, Value>>&& entries) {
+        putBatch<true>(entries);
+    }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), cache.size(), std::max(capacity, 0),
+                                              stats::CacheStats::EXPIRATIONS);
+    }
+};
+
+// ==================== TTL Cache (hierarchical timing wheel) ====================
+#include <cstdint>
+
+// Expiry is driven by a 4-level hashed timing wheel (64 slots per level, one
+// tick = tickMs) instead of scanning the recency list, so an entry expires on
+// time even when hot keys sit behind it in LRU order. Each operation reads the
+// clock once. Per-level occupancy bitmaps let advance() jump straight to the
+// next tick with a non-empty slot, so idle time costs nothing. Every step
+// moves or expires at least one entry, and an entry cascades at most LEVELS
+// times per schedule, which keeps advancing amortized O(1) per operation plus
+// its expirations. TTLs may differ per key. Clock can be swapped for a
+// manually advanced one to replay long idle gaps.
+template<typename Clock = std::chrono::steady_clock>
+class TimingWheelTTLCache {
+private:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const uint64_t SLOT_MASK = SLOTS - 1;
+    static const uint64_t MAX_SPAN = 1ULL << (LEVELS * SLOT_BITS);
+    
+    struct Entry;
+    using EntryList = std::list<Entry>;
+    using EntryIter = typename EntryList::iterator;
+    using SlotList = std::list<EntryIter>;
+    
+    struct Entry {
+        int key;
+        int value;
+        uint64_t ttlTicks;
+        uint64_t expiryTick;
+        int level;
+        int slot;
+        typename SlotList::iterator wheelPos;
+    };
+    
+    int capacity;
+    int defaultTtlMs;
+    std::chrono::milliseconds tick;
+    typename Clock::time_point start;
+    uint64_t currentTick;
+    
+    EntryList cache;  // Recency order, most recent at front
+    std::unordered_map<int, EntryIter> map;
+    SlotList wheel[LEVELS][SLOTS];
+    uint64_t occupied[LEVELS];  // Bit s set while wheel[level][s] is non-empty
+    DSA_STAT(stats::CacheCounters counters;)
+    
+    uint64_t nowTick() const {
+        return (Clock::now() - start) / tick;
+    }
+    
+    uint64_t toTicks(int ttlMs) const {
+        // At least one tick, so a fresh entry is never due in a slot that
+        // has already been processed for the current tick
+        uint64_t t = tick.count();
+        return std::max<uint64_t>(1, (static_cast<uint64_t>(std::max(ttlMs, 0)) + t - 1) / t);
+    }
+    
+    // Level is the smallest whose span covers the delay; slot comes from the
+    // absolute expiry bits so cascading can redistribute without a scan.
+    // Cascades run before the current tick's level-0 slot, so an entry due
+    // right now still lands in time.
+    void locate(uint64_t expiryTick, int& level, int& slot) const {
+        uint64_t target = std::min(std::max(expiryTick, currentTick),
+                                   currentTick + MAX_SPAN - 1);
+        uint64_t delta = target - currentTick;
+        level = 0;
+        while (level < LEVELS - 1 && delta >= (1ULL << (SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+        slot = static_cast<int>((target >> (SLOT_BITS * level)) & SLOT_MASK);
+    }
+    
+    void updateOccupancy(int level, int slot) {
+        if (wheel[level][slot].empty()) {
+            occupied[level] &= ~(1ULL << slot);
+        } else {
+            occupied[level] |= 1ULL << slot;
+        }
+    }
+    
+    void schedule(EntryIter it) {
+        int level, slot;
+        locate(it->expiryTick, level, slot);
+        it->level = level;
+        it->slot = slot;
+        it->wheelPos = wheel[level][slot].insert(wheel[level][slot].end(), it);
+        occupied[level] |= 1ULL << slot;
+    }
+    
+    void reschedule(EntryIter it) {
+        int level, slot;
+        locate(it->expiryTick, level, slot);
+        SlotList& to = wheel[level][slot];
+        to.splice(to.end(), wheel[it->level][it->slot], it->wheelPos);
+        updateOccupancy(it->level, it->slot);
+        occupied[level] |= 1ULL << slot;
+        it->level = level;
+        it->slot = slot;
+    }
+    
+    void erase(EntryIter it) {
+        wheel[it->level][it->slot].erase(it->wheelPos);
+        updateOccupancy(it->level, it->slot);
+        map.erase(it->key);
+        cache.erase(it);
+    }
+    
+    void cascade(int level, int slot) {
+        SlotList pending;
+        pending.splice(pending.end(), wheel[level][slot]);
+        occupied[level] &= ~(1ULL << slot);
+        while (!pending.empty()) {
+            auto it = pending.front();
+            locate(it->expiryTick, it->level, it->slot);
+            SlotList& to = wheel[it->level][it->slot];
+            to.splice(to.end(), pending, pending.begin());
+            occupied[it->level] |= 1ULL << it->slot;
+        }
+    }
+    
+    // Earliest tick after currentTick with work to do: a non-empty level-0
+    // slot coming due, or a boundary that cascades a non-empty higher-level
+    // slot. Level L's slots come up in circular order at multiples of 64^L,
+    // so rotating its bitmap to the next boundary's slot and taking ctz gives
+    // the number of boundaries to skip. UINT64_MAX if the wheel is empty.
+    uint64_t nextEventTick() const {
+        uint64_t next = UINT64_MAX;
+        for (int level = 0; level < LEVELS; level++) {
+            if (!occupied[level]) continue;
+            int shift = SLOT_BITS * level;
+            uint64_t boundary = (currentTick >> shift) + 1;
+            int r = static_cast<int>(boundary & SLOT_MASK);
+            uint64_t rotated = r ? (occupied[level] >> r) | (occupied[level] << (SLOTS - r))
+                                 : occupied[level];
+            next = std::min(next, (boundary + __builtin_ctzll(rotated)) << shift);
+        }
+        return next;
+    }
+    
+    // Ticks between events would only find empty slots, so they are skipped
+    void advance(uint64_t now) {
+        while (currentTick < now) {
+            uint64_t next = nextEventTick();
+            if (next > now) {
+                currentTick = now;
+                return;
+            }
+            currentTick = next;
+            
+            // Higher levels first so a cascade can feed a lower level's slot
+            // that is due on this same tick
+            for (int level = LEVELS - 1; level >= 1; level--) {
+                if ((currentTick & ((1ULL << (SLOT_BITS * level)) - 1)) == 0) {
+                    cascade(level, static_cast<int>((currentTick >> (SLOT_BITS * level)) & SLOT_MASK));
+                }
+            }
+            
+            SlotList& due = wheel[0][currentTick & SLOT_MASK];
+            while (!due.empty()) {
+                auto it = due.front();
+                if (it->expiryTick <= currentTick) {
+                    erase(it);
+                    DSA_STAT(counters.expirations.add();)
+                } else {
+                    reschedule(it);
+                }
+            }
+        }
+    }
+
+public:
+    TimingWheelTTLCache(int capacity, int defaultTtlMs, int tickMs = 1)
+        : capacity(capacity), defaultTtlMs(defaultTtlMs),
+          tick(std::max(tickMs, 1)), start(Clock::now()),
+          currentTick(0), occupied{} {}
+    
+    int get(int key) {
+        advance(nowTick());
+        
+        auto found = map.find(key);
+        if (found == map.end()) {
+            DSA_STAT(counters.misses.add();)
+            return -1;
+        }
+        
+        // Move to front and refresh this key's TTL
+        DSA_STAT(counters.hits.add();)
+        auto it = found->second;
+        it->expiryTick = currentTick + it->ttlTicks;
+        reschedule(it);
+        cache.splice(cache.begin(), cache, it);
+        return it->value;
+    }
+    
+    void put(int key, int value) {
+        put(key, value, defaultTtlMs);
+    }
+    
+    void put(int key, int value, int ttlMs) {
+        if (capacity <= 0) return;
+        advance(nowTick());
+        
+        uint64_t ttlTicks = toTicks(ttlMs);
+        auto found = map.find(key);
+        if (found != map.end()) {
+            auto it = found->second;
+            it->value = value;
+            it->ttlTicks = ttlTicks;
+            it->expiryTick = currentTick + ttlTicks;
+            reschedule(it);
+            cache.splice(cache.begin(), cache, it);
+            return;
+        }
+        
+        if (static_cast<int>(cache.size()) >= capacity) {
+            erase(std::prev(cache.end()));  // Evict LRU
+            DSA_STAT(counters.evictions.add();)
+        }
+        
+        cache.push_front(Entry{key, value, ttlTicks, currentTick + ttlTicks, 0, 0, {}});
+        map[key] = cache.begin();
+        schedule(cache.begin());
+    }
+    
+    int size() const { return static_cast<int>(cache.size()); }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), cache.size(), std::max(capacity, 0),
+                                              stats::CacheStats::EXPIRATIONS);
+    }
+};
+
+// ==================== Slab-backed LRU / TTL Cache ====================
+#include <vector>
+#include <cstdint>
+
+// All `capacity` entries are preallocated in one contiguous slab. The recency
+// list is intrusive (32-bit prev/next indices inside each entry) and the index
+// is an open-addressing table with linear probing and backward-shift deletion,
+// so after construction get/put never touch the allocator.
+//
+// Entry must expose `int key` and `uint32_t prev, next`.
+template<typename Entry>
+class IntrusiveSlab {
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+private:
+    std::vector<Entry> nodes;
+    std::vector<uint32_t> table;  // node index per slot, NIL if empty
+    uint32_t mask;
+    uint32_t head = NIL;  // most recent
+    uint32_t tail = NIL;  // least recent
+    uint32_t freeHead = NIL;
+    uint32_t count = 0;
+    DSA_STAT(mutable stats::Counter probes;)
+
+    static uint32_t hashKey(int key) {
+        uint32_t h = static_cast<uint32_t>(key);
+        h ^= h >> 16;
+        h *= 0x85ebca6bU;
+        h ^= h >> 13;
+        return h;
+    }
+
+    uint32_t findSlot(int key) const {
+        DSA_STAT(uint64_t inspected = 0;)
+        for (uint32_t slot = hashKey(key) & mask; ; slot = (slot + 1) & mask) {
+            DSA_STAT(inspected++;)
+            uint32_t idx = table[slot];
+            if (idx == NIL || nodes[idx].key == key) {
+                DSA_STAT(probes.add(inspected);)
+                return slot;
+            }
+        }
+    }
+
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    void clearSlot(uint32_t hole) {
+        table[hole] = NIL;
+        for (uint32_t j = (hole + 1) & mask; table[j] != NIL; j = (j + 1) & mask) {
+            uint32_t home = hashKey(nodes[table[j]].key) & mask;
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                table[hole] = table[j];
+                table[j] = NIL;
+                hole = j;
+            }
+        }
+    }
+
+    void unlink(uint32_t idx) {
+        Entry& e = nodes[idx];
+        if (e.prev != NIL) nodes[e.prev].next = e.next; else head = e.next;
+        if (e.next != NIL) nodes[e.next].prev = e.prev; else tail = e.prev;
+    }
+
+    void linkFront(uint32_t idx) {
+        nodes[idx].prev = NIL;
+        nodes[idx].next = head;
+        if (head != NIL) nodes[head].prev = idx; else tail = idx;
+        head = idx;
+    }
+
+public:
+    explicit IntrusiveSlab(uint32_t capacity) : nodes(capacity) {
+        // Keep load factor <= 0.5 so probe sequences stay short
+        uint32_t tableSize = 2;
+        while (tableSize < 2 * capacity) tableSize <<= 1;
+        table.assign(tableSize, NIL);
+        mask = tableSize - 1;
+
+        for (uint32_t i = 0; i < capacity; i++) {
+            nodes[i].next = (i + 1 < capacity) ? i + 1 : NIL;
+        }
+        freeHead = capacity > 0 ? 0 : NIL;
+    }
+
+    uint32_t find(int key) const { return table[findSlot(key)]; }
+    
+    // Touch the key's home slot ahead of a later find()
+    void prefetch(int key) const { CACHE_PREFETCH(&table[hashKey(key) & mask]); }
+
+    Entry& at(uint32_t idx) { return nodes[idx]; }
+
+    uint32_t back() const { return tail; }
+    uint32_t size() const { return count; }
+    uint32_t capacity() const { return static_cast<uint32_t>(nodes.size()); }
+    bool full() const { return freeHead == NIL; }
+    
+    // Table slots inspected by every lookup so far; 0 unless built with DSA_STATS
+    uint64_t probeCount() const {
+#if DSA_STATS_ENABLED
+        return probes.value();
+#else
+        return 0;
+#endif
+    }
+
+    void moveToFront(uint32_t idx) {
+        if (idx == head) return;
+        unlink(idx);
+        linkFront(idx);
+    }
+
+    // Caller must ensure !full() and that key is absent
+    uint32_t insertFront(int key) {
+        uint32_t idx = freeHead;
+        freeHead = nodes[idx].next;
+        nodes[idx].key = key;
+        table[findSlot(key)] = idx;
+        linkFront(idx);
+        count++;
+        return idx;
+    }
+
+    void erase(uint32_t idx) {
+        clearSlot(findSlot(nodes[idx].key));
+        unlink(idx);
+        nodes[idx].next = freeHead;
+        freeHead = idx;
+        count--;
+    }
+};
+
+class SlabLRUCache {
+private:
+    struct Entry {
+        int key;
+        int value;
+        uint32_t prev, next;
+    };
+
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+    
+    IntrusiveSlab<Entry> slab;
+    DSA_STAT(stats::CacheCounters counters;)
+
+public:
+    SlabLRUCache(int capacity) : slab(static_cast<uint32_t>(std::max(capacity, 0))) {}
+
+    int get(int key) {
+        uint32_t idx = slab.find(key);
+        if (idx == IntrusiveSlab<Entry>::NIL) {
+            DSA_STAT(counters.misses.add();)
+            return -1;
+        }
+
+        DSA_STAT(counters.hits.add();)
+        slab.moveToFront(idx);
+        return slab.at(idx).value;
+    }
+
+    void put(int key, int value) {
+        if (slab.capacity() == 0) return;
+
+        uint32_t idx = slab.find(key);
+        if (idx != IntrusiveSlab<Entry>::NIL) {
+            slab.at(idx).value = value;
+            slab.moveToFront(idx);
+            return;
+        }
+
+        if (slab.full()) {
+            slab.erase(slab.back());  // Evict LRU; its slot is reused below
+            DSA_STAT(counters.evictions.add();)
+        }
+        slab.at(slab.insertFront(key)).value = value;
+    }
+    
+    // Home slots are prefetched PREFETCH_DISTANCE keys ahead of the probe
+    std::vector<int> getMany(const std::vector<int>& keys) {
+        const size_t n = keys.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            slab.prefetch(keys[i]);
+        }
+        
+        std::vector<int> result(n);
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) slab.prefetch(keys[i + PREFETCH_DISTANCE]);
+            result[i] = get(keys[i]);
+        }
+        return result;
+    }
+    
+    void putMany(const std::vector<std::pair<int, int>>& entries) {
+        const size_t n = entries.size();
+        for (size_t i = 0; i < std::min(n, PREFETCH_DISTANCE); i++) {
+            slab.prefetch(entries[i].first);
+        }
+        
+        for (size_t i = 0; i < n; i++) {
+            if (i + PREFETCH_DISTANCE < n) slab.prefetch(entries[i + PREFETCH_DISTANCE].first);
+            put(entries[i].first, entries[i].second);
+        }
+    }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), slab.size(), slab.capacity(),
+                                              stats::CacheStats::PROBES, slab.probeCount());
+    }
+};
+
+class SlabTTLCache {
+private:
+    struct Entry {
+        int key;
+        int value;
+        uint32_t prev, next;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    IntrusiveSlab<Entry> slab;
+    int ttlMs;
+    DSA_STAT(stats::CacheCounters counters;)
+
+    void evictExpired(std::chrono::steady_clock::time_point now) {
+        while (slab.size() > 0 && now > slab.at(slab.back()).expiry) {
+            slab.erase(slab.back());
+            DSA_STAT(counters.expirations.add();)
+        }
+    }
+
+public:
+    SlabTTLCache(int capacity, int ttlMs)
+        : slab(static_cast<uint32_t>(std::max(capacity, 0))), ttlMs(ttlMs) {}
+
+    int get(int key) {
+        auto now = std::chrono::steady_clock::now();
+        evictExpired(now);
+
+        uint32_t idx = slab.find(key);
+        if (idx == IntrusiveSlab<Entry>::NIL) {
+            DSA_STAT(counters.misses.add();)
+            return -1;
+        }
+
+        Entry& entry = slab.at(idx);
+        if (now > entry.expiry) {
+            slab.erase(idx);
+            DSA_STAT(counters.expirations.add(); counters.misses.add();)
+            return -1;
+        }
+
+        // Move to front and refresh TTL
+        DSA_STAT(counters.hits.add();)
+        entry.expiry = now + std::chrono::milliseconds(ttlMs);
+        slab.moveToFront(idx);
+        return entry.value;
+    }
+
+    void put(int key, int value) {
+        if (slab.capacity() == 0) return;
+
+        auto now = std::chrono::steady_clock::now();
+        evictExpired(now);
+        auto expiry = now + std::chrono::milliseconds(ttlMs);
+
+        uint32_t idx = slab.find(key);
+        if (idx == IntrusiveSlab<Entry>::NIL) {
+            if (slab.full()) {
+                slab.erase(slab.back());
+                DSA_STAT(counters.evictions.add();)
+            }
+            idx = slab.insertFront(key);
+        } else {
+            slab.moveToFront(idx);
+        }
+
+        Entry& entry = slab.at(idx);
+        entry.value = value;
+        entry.expiry = expiry;
+    }
+    
+    stats::CacheStats stats() const {
+        return stats::CacheCounters::snapshot(DSA_STAT_PTR(counters), slab.size(), slab.capacity(),
+                                              stats::CacheStats::EXPIRATIONS | stats::CacheStats::PROBES,
+                                              slab.probeCount());
+    }
+};
+
+// ==================== Concurrent LRU Cache (sharded) ====================
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+
+// Keys are split across independent LRU shards by hash, each guarded by its
+// own mutex, so threads touching different shards never contend. Recency is
+// tracked per shard: eviction picks the LRU entry of the key's shard, which
+// approximates global LRU when keys hash uniformly.
+template<typename K, typename V, typename Hash = std::hash<K>>
+class ConcurrentLRUCache {
+public:
+    struct ShardStats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t size = 0;
+    };
+
+private:
+    // alignas(64) keeps each shard's mutex on its own cache line
+    struct alignas(64) Shard {
+        std::mutex mtx;
+        size_t capacity = 0;
+        std::list<std::pair<K, V>> cache;  // {key, value}
+        std::unordered_map<K, typename std::list<std::pair<K, V>>::iterator, Hash> map;
+        ShardStats stats;
+    };
+
+    std::vector<Shard> shards;
+    Hash hasher;
+
+    size_t shardIndex(const K& key) const {
+        // Finalizer mix so identity hashes (e.g. std::hash<int>) still spread evenly
+        uint64_t h = hasher(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h % shards.size();
+    }
+    
+    Shard& shardFor(const K& key) { return shards[shardIndex(key)]; }
+    
+    // Positions of batch entries grouped by shard, preserving batch order within a shard
+    template<typename KeyOf, typename Batch>
+    std::vector<std::vector<size_t>> groupByShard(const Batch& batch, KeyOf keyOf) const {
+        std::vector<std::vector<size_t>> groups(shards.size());
+        for (size_t i = 0; i < batch.size(); i++) {
+            groups[shardIndex(keyOf(batch[i]))].push_back(i);
+        }
+        return groups;
+    }
+    
+    std::optional<V> getLocked(Shard& shard, const K& key) {
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            shard.stats.misses++;
+            return std::nullopt;
+        }
+        
+        shard.stats.hits++;
+        shard.cache.splice(shard.cache.begin(), shard.cache, it->second);
+        return it->second->second;
+    }
+    
+    void putLocked(Shard& shard, const K& key, const V& value) {
+        if (shard.capacity == 0) return;
+        
+        auto it = shard.map.find(key);
+        if (it != shard.map.end()) {
+            it->second->second = value;
+            shard.cache.splice(shard.cache.begin(), shard.cache, it->second);
+            return;
+        }
+        
+        if (shard.cache.size() >= shard.capacity) {
+            shard.map.erase(shard.cache.back().first);
+            shard.cache.pop_back();
+            shard.stats.evictions++;
+        }
+        
+        shard.cache.emplace_front(key, value);
+        shard.map[key] = shard.cache.begin();
+    }
+
+public:
+    ConcurrentLRUCache(size_t capacity,
+                       size_t shardCount = std::max(1u, std::thread::hardware_concurrency()))
+        : shards(std::max<size_t>(1, std::min(shardCount, std::max<size_t>(1, capacity)))) {
+        // Spread capacity so the shard total is exactly `capacity`
+        size_t base = capacity / shards.size();
+        size_t extra = capacity % shards.size();
+        for (size_t i = 0; i < shards.size(); i++) {
+            shards[i].capacity = base + (i < extra ? 1 : 0);
+        }
+    }
+
+    std::optional<V> get(const K& key) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mtx);
+        return getLocked(shard, key);
+    }
+
+    void put(const K& key, const V& value) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mtx);
+        putLocked(shard, key, value);
+    }
+
+    // Each shard's lock is taken once per batch rather than once per key
+    std::vector<std::optional<V>> getMany(const std::vector<K>& keys) {
+        std::vector<std::optional<V>> result(keys.size());
+        auto groups = groupByShard(keys, [](const K& key) -> const K& { return key; });
+        for (size_t s = 0; s < shards.size(); s++) {
+            if (groups[s].empty()) continue;
+            std::lock_guard<std::mutex> lock(shards[s].mtx);
+            for (size_t i : groups[s]) {
+                result[i] = getLocked(shards[s], keys[i]);
+            }
+        }
+        return result;
+    }
+
+    void putMany(const std::vector<std::pair<K, V>>& entries) {
+        auto groups = groupByShard(entries, [](const std::pair<K, V>& e) -> const K& { return e.first; });
+        for (size_t s = 0; s < shards.size(); s++) {
+            if (groups[s].empty()) continue;
+            std::lock_guard<std::mutex> lock(shards[s].mtx);
+            for (size_t i : groups[s]) {
+                putLocked(shards[s], entries[i].first, entries[i].second);
+            }
+        }
+    }
+
+    size_t size() {
+        size_t total = 0;
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            total += shard.cache.size();
+        }
+        return total;
+    }
+
+    size_t shardCount() const { return shards.size(); }
+
+    ShardStats shardStats(size_t i) {
+        std::lock_guard<std::mutex> lock(shards[i].mtx);
+        ShardStats s = shards[i].stats;
+        s.size = shards[i].cache.size();
+        return s;
+    }
+
+    // Totals over all shards. The per-shard counters are kept under the
+    // shard locks and are always on, with or without DSA_STATS.
+    stats::CacheStats stats() {
+        stats::CacheStats total;
+        total.counted = true;
+        for (size_t i = 0; i < shards.size(); i++) {
+            ShardStats s = shardStats(i);
+            total.hits += s.hits;
+            total.misses += s.misses;
+            total.evictions += s.evictions;
+            total.size += s.size;
+            total.capacity += shards[i].capacity;
+        }
+        return total;
+    }
+};
+
+#endif  // DSA_LRU_CACHE_H
@@ -0,0 +1,387 @@
+/**
+ * Monotonic Stack and Deque Implementation in C++
+ * 
+ * Shared by MonotonicStack.cpp and the bench/ suite.
+ */
+
+#ifndef DSA_MONOTONIC_STACK_H
+#define DSA_MONOTONIC_STACK_H
+
+#include <vector>
+#include <deque>
+#include <climits>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+
+#include "ThreadPool.h"
+
+class MonotonicStack {
+public:
+    // Next Greater Element
+    static std::vector<int> nextGreaterElement(const std::vector<int>& nums) {
+        int n = nums.size();
+        std::vector<int> result(n, -1);
+        std::vector<int> st;  // Indices, used as a stack
+        
+        for (int i = 0; i < n; i++) {
+            while (!st.empty() && nums[st.back()] < nums[i]) {
+                result[st.back()] = nums[i];
+                st.pop_back();
+            }
+            st.push_back(i);
+        }
+        return result;
+    }
+    
+    // Next Greater Element (Circular)
+    static std::vector<int> nextGreaterCircular(const std::vector<int>& nums) {
+        int n = nums.size();
+        std::vector<int> result(n, -1);
+        std::vector<int> st;
+        
+        for (int i = 0; i < 2 * n; i++) {
+            int num = nums[i % n];
+            while (!st.empty() && nums[st.back()] < num) {
+                result[st.back()] = num;
+                st.pop_back();
+            }
+            if (i < n) st.push_back(i);
+        }
+        return result;
+    }
+    
+    // Daily Temperatures
+    static std::vector<int> dailyTemperatures(const std::vector<int>& temps) {
+        int n = temps.size();
+        std::vector<int> result(n, 0);
+        std::vector<int> st;
+        
+        for (int i = 0; i < n; i++) {
+            while (!st.empty() && temps[st.back()] < temps[i]) {
+                result[st.back()] = i - st.back();
+                st.pop_back();
+            }
+            st.push_back(i);
+        }
+        return result;
+    }
+    
+    // Largest Rectangle in Histogram
+    static int largestRectangle(const std::vector<int>& heights) {
+        int n = heights.size();
+        int maxArea = 0;
+        std::vector<int> st;
+        
+        for (int i = 0; i <= n; i++) {
+            int h = (i == n) ? 0 : heights[i];
+            
+            while (!st.empty() && heights[st.back()] > h) {
+                int height = heights[st.back()];
+                st.pop_back();
+                int width = st.empty() ? i : i - st.back() - 1;
+                maxArea = std::max(maxArea, height * width);
+            }
+            st.push_back(i);
+        }
+        return maxArea;
+    }
+    
+    // Trapping Rain Water
+    static int trapRainWater(const std::vector<int>& height) {
+        int n = height.size();
+        int water = 0;
+        std::vector<int> st;
+        
+        for (int i = 0; i < n; i++) {
+            while (!st.empty() && height[st.back()] < height[i]) {
+                int bottom = st.back();
+                st.pop_back();
+                if (st.empty()) break;
+                
+                int left = st.back();
+                int width = i - left - 1;
+                int boundedHeight = std::min(height[left], height[i]) - height[bottom];
+                water += width * boundedHeight;
+            }
+            st.push_back(i);
+        }
+        return water;
+    }
+    
+    // Trapping Rain Water, two pointers meeting at the tallest bar. Left of
+    // the peak the water over i is leftMax - height[i] (mirror on the right),
+    // so each sweep is a branchless running max plus subtraction that the
+    // compiler can keep in registers. 64-bit total for very long inputs.
+    static long long trapRainWaterTwoPointer(const std::vector<int>& height) {
+        int n = height.size();
+        if (n == 0) return 0;
+        int peak = std::max_element(height.begin(), height.end()) - height.begin();
+        
+        long long water = 0;
+        int leftMax = 0;
+        for (int left = 0; left < peak; left++) {
+            leftMax = std::max(leftMax, height[left]);
+            water += leftMax - height[left];
+        }
+        int rightMax = 0;
+        for (int right = n - 1; right > peak; right--) {
+            rightMax = std::max(rightMax, height[right]);
+            water += rightMax - height[right];
+        }
+        return water;
+    }
+    
+    // Parallel Next Greater Element: same result as nextGreaterElement
+    static std::vector<int> nextGreaterElementParallel(const std::vector<int>& nums, ThreadPool& pool) {
+        std::vector<int> next = nextIndexParallel(
+            nums.size(), [&](int i) { return nums[i]; }, std::less<int>(), pool);
+        pool.parallelFor(next.size(), 1 << 16, [&](size_t lo, size_t hi, unsigned) {
+            for (size_t i = lo; i < hi; i++) next[i] = next[i] < 0 ? -1 : nums[next[i]];
+        });
+        return next;
+    }
+    
+    // Parallel Largest Rectangle: each bar's rectangle spans the gap between
+    // its nearest strictly lower bars on both sides, found with two parallel
+    // next-smaller passes (the left one on the reversed array)
+    static long long largestRectangleParallel(const std::vector<int>& heights, ThreadPool& pool) {
+        const int n = heights.size();
+        std::vector<int> right = nextIndexParallel(
+            n, [&](int i) { return heights[i]; }, std::greater<int>(), pool);
+        std::vector<int> left = nextIndexParallel(
+            n, [&](int i) { return heights[n - 1 - i]; }, std::greater<int>(), pool);
+        
+        std::vector<long long> best(pool.size(), 0);
+        pool.parallelFor(n, 1 << 16, [&](size_t lo, size_t hi, unsigned worker) {
+            long long area = 0;
+            for (size_t i = lo; i < hi; i++) {
+                int r = right[i] < 0 ? n : right[i];
+                int l = left[n - 1 - i] < 0 ? -1 : n - 1 - left[n - 1 - i];
+                area = std::max(area, (long long)heights[i] * (r - l - 1));
+            }
+            best[worker] = std::max(best[worker], area);
+        });
+        return *std::max_element(best.begin(), best.end());
+    }
+
+private:
+    // next[i] = first j > i with comp(value(i), value(j)), or -1.
+    // Chunks run the sequential stack in parallel, each leaving a residue of
+    // unresolved indices and its list of prefix records (elements that beat
+    // everything before them in the chunk, increasing under comp). Only a
+    // record can resolve an earlier chunk's residue, so a sequential merge
+    // walks chunks in order and binary-searches each residue top against
+    // the records, touching only cross-chunk work.
+    template<typename Value, typename Comp>
+    static std::vector<int> nextIndexParallel(int n, Value value, Comp comp, ThreadPool& pool) {
+        std::vector<int> next(n, -1);
+        if (n == 0) return next;
+        
+        const size_t chunkCount = std::min<size_t>(n, pool.size() * 4);
+        const size_t grain = (n + chunkCount - 1) / chunkCount;
+        std::vector<std::vector<int>> residue(chunkCount), records(chunkCount);
+        
+        pool.parallelFor(n, grain, [&](size_t lo, size_t hi, unsigned) {
+            std::vector<int>& st = residue[lo / grain];
+            std::vector<int>& rec = records[lo / grain];
+            for (size_t i = lo; i < hi; i++) {
+                while (!st.empty() && comp(value(st.back()), value(i))) {
+                    next[st.back()] = i;
+                    st.pop_back();
+                }
+                st.push_back(i);
+                if (rec.empty() || comp(value(rec.back()), value(i))) rec.push_back(i);
+            }
+        });
+        
+        // Pending residues, oldest chunk first; tops are the weakest values
+        std::vector<int> pending;
+        auto resolves = [&](int top, int record) { return comp(value(top), value(record)); };
+        for (size_t c = 0; c < chunkCount; c++) {
+            const std::vector<int>& rec = records[c];
+            auto pos = rec.begin();
+            while (!pending.empty()) {
+                std::vector<int>& st = residue[pending.back()];
+                pos = std::upper_bound(pos, rec.end(), st.back(), resolves);
+                if (pos == rec.end()) break;
+                next[st.back()] = *pos;
+                st.pop_back();
+                if (st.empty()) pending.pop_back();
+            }
+            if (!residue[c].empty()) pending.push_back(c);
+        }
+        return next;
+    }
+};
+
+class MonotonicDeque {
+public:
+    // Sliding Window Maximum
+    static std::vector<int> maxSlidingWindow(const std::vector<int>& nums, int k) {
+        int n = nums.size();
+        std::vector<int> result;
+        std::deque<int> dq;  // Indices
+        
+        for (int i = 0; i < n; i++) {
+            // Remove elements outside window
+            while (!dq.empty() && dq.front() < i - k + 1) {
+                dq.pop_front();
+            }
+            
+            // Remove smaller elements
+            while (!dq.empty() && nums[dq.back()] < nums[i]) {
+                dq.pop_back();
+            }
+            
+            dq.push_back(i);
+            
+            if (i >= k - 1) {
+                result.push_back(nums[dq.front()]);
+            }
+        }
+        return result;
+    }
+    
+    // Sliding Window Minimum
+    static std::vector<int> minSlidingWindow(const std::vector<int>& nums, int k) {
+        int n = nums.size();
+        std::vector<int> result;
+        std::deque<int> dq;
+        
+        for (int i = 0; i < n; i++) {
+            while (!dq.empty() && dq.front() < i - k + 1) {
+                dq.pop_front();
+            }
+            while (!dq.empty() && nums[dq.back()] > nums[i]) {
+                dq.pop_back();
+            }
+            dq.push_back(i);
+            
+            if (i >= k - 1) {
+                result.push_back(nums[dq.front()]);
+            }
+        }
+        return result;
+    }
+};
+
+// ==================== Streaming Sliding Window ====================
+// Push-based sliding maximum (or minimum with std::greater) for unbounded
+// streams. Each entry carries a key: a sequence number for count windows,
+// a timestamp for time windows; the window holds keys in (last - span, last].
+// The monotone deque lives in a power-of-two ring buffer of (value, key), so
+// push is O(1) amortized with no per-element allocation. A count window
+// never holds more than `span` entries and never grows; a time window
+// doubles its ring only if more entries than the current capacity survive.
+template<typename T, typename Compare = std::less<T>>
+class SlidingWindowMax {
+private:
+    struct Entry {
+        T value;
+        int64_t key;
+    };
+    
+    std::vector<Entry> ring;
+    size_t mask;
+    size_t head;   // Index of the front (current best)
+    size_t count;  // Entries in the deque
+    int64_t span;
+    int64_t nextSequence;
+    Compare comp;
+    
+    static size_t roundUpPowerOfTwo(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+    
+    Entry& at(size_t offset) { return ring[(head + offset) & mask]; }
+    
+    void grow() {
+        std::vector<Entry> larger(ring.size() * 2);
+        for (size_t i = 0; i < count; i++) larger[i] = std::move(at(i));
+        ring.swap(larger);
+        mask = ring.size() - 1;
+        head = 0;
+    }
+
+public:
+    // Count window over the last `window` pushes
+    explicit SlidingWindowMax(size_t window)
+        : ring(roundUpPowerOfTwo(std::max<size_t>(window, 1))), mask(ring.size() - 1),
+          head(0), count(0), span(std::max<size_t>(window, 1)), nextSequence(0) {}
+    
+    // Time window: keep keys within `duration` of the newest key.
+    // initialCapacity only sizes the ring up front.
+    static SlidingWindowMax timeWindow(int64_t duration, size_t initialCapacity = 64) {
+        SlidingWindowMax window(initialCapacity);
+        window.span = duration;
+        return window;
+    }
+    
+    // Count-window push
+    void push(const T& value) { push(value, nextSequence++); }
+    
+    // Keys must be non-decreasing
+    void push(const T& value, int64_t key) {
+        expire(key);
+        while (count > 0 && comp(at(count - 1).value, value)) count--;
+        if (count == ring.size()) grow();
+        at(count++) = Entry{value, key};
+    }
+    
+    // Drops entries that fell out of the window ending at `now`
+    void expire(int64_t now) {
+        while (count > 0 && at(0).key <= now - span) {
+            head = (head + 1) & mask;
+            count--;
+        }
+    }
+    
+    bool empty() const { return count == 0; }
+    
+    // Best value in the window; the window must not be empty
+    const T& current() const { return ring[head].value; }
+};
+
+// Fused min+max: one push feeds both deques
+template<typename T>
+class SlidingWindowMinMax {
+private:
+    SlidingWindowMax<T, std::less<T>> maxWindow;
+    SlidingWindowMax<T, std::greater<T>> minWindow;
+    
+    SlidingWindowMinMax(SlidingWindowMax<T, std::less<T>> maxWindow,
+                        SlidingWindowMax<T, std::greater<T>> minWindow)
+        : maxWindow(std::move(maxWindow)), minWindow(std::move(minWindow)) {}
+
+public:
+    explicit SlidingWindowMinMax(size_t window) : maxWindow(window), minWindow(window) {}
+    
+    static SlidingWindowMinMax timeWindow(int64_t duration, size_t initialCapacity = 64) {
+        return SlidingWindowMinMax(SlidingWindowMax<T, std::less<T>>::timeWindow(duration, initialCapacity),
+                                   SlidingWindowMax<T, std::greater<T>>::timeWindow(duration, initialCapacity));
+    }
+    
+    void push(const T& value) {
+        maxWindow.push(value);
+        minWindow.push(value);
+    }
+    
+    void push(const T& value, int64_t key) {
+        maxWindow.push(value, key);
+        minWindow.push(value, key);
+    }
+    
+    void expire(int64_t now) {
+        maxWindow.expire(now);
+        minWindow.expire(now);
+    }
+    
+    bool empty() const { return maxWindow.empty(); }
+    const T& currentMax() const { return maxWindow.current(); }
+    const T& currentMin() const { return minWindow.current(); }
+};
+
+#endif  // DSA_MONOTONIC_STACK_H
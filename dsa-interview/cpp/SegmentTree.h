@@ -0,0 +1,814 @@
+/**
+ * Segment Tree Implementation in C++
+ * 
+ * Time Complexity:
+ * - Build: O(n)
+ * - Query: O(log n)
+ * - Update: O(log n)
+ * 
+ * Space Complexity: O(n)
+ * 
+ * Shared by SegmentTree.cpp and the bench/ suite.
+ */
+
+#ifndef DSA_SEGMENT_TREE_H
+#define DSA_SEGMENT_TREE_H
+
+#include <vector>
+#include <climits>
+#include <functional>
+#include <limits>
+#include <algorithm>
+#include <optional>
+#include <iterator>
+#include <cstdint>
+#include <numeric>
+#include <cmath>
+
+#include "ThreadPool.h"
+
+// ==================== Generic Segment Tree ====================
+template<typename T>
+class SegmentTree {
+private:
+    std::vector<T> tree;
+    std::vector<T> lazy;
+    int n;
+    T identity;
+    std::function<T(T, T)> combine;
+    
+    void build(const std::vector<T>& nums, int node, int start, int end) {
+        if (start == end) {
+            tree[node] = nums[start];
+        } else {
+            int mid = start + (end - start) / 2;
+            build(nums, 2 * node + 1, start, mid);
+            build(nums, 2 * node + 2, mid + 1, end);
+            tree[node] = combine(tree[2 * node + 1], tree[2 * node + 2]);
+        }
+    }
+    
+    void updateHelper(int node, int start, int end, int idx, T val) {
+        if (start == end) {
+            tree[node] = val;
+        } else {
+            int mid = start + (end - start) / 2;
+            if (idx <= mid) {
+                updateHelper(2 * node + 1, start, mid, idx, val);
+            } else {
+                updateHelper(2 * node + 2, mid + 1, end, idx, val);
+            }
+            tree[node] = combine(tree[2 * node + 1], tree[2 * node + 2]);
+        }
+    }
+    
+    T queryHelper(int node, int start, int end, int l, int r) const {
+        if (r < start || end < l) return identity;
+        if (l <= start && end <= r) return tree[node];
+        
+        int mid = start + (end - start) / 2;
+        return combine(
+            queryHelper(2 * node + 1, start, mid, l, r),
+            queryHelper(2 * node + 2, mid + 1, end, l, r)
+        );
+    }
+
+public:
+    SegmentTree(const std::vector<T>& nums, T identity, std::function<T(T, T)> combine)
+        : n(nums.size()), identity(identity), combine(combine) {
+        tree.resize(4 * n);
+        lazy.resize(4 * n, identity);
+        build(nums, 0, 0, n - 1);
+    }
+    
+    void update(int idx, T val) {
+        updateHelper(0, 0, n - 1, idx, val);
+    }
+    
+    T query(int l, int r) const {
+        return queryHelper(0, 0, n - 1, l, r);
+    }
+};
+
+// ==================== Compile-Time Monoid Segment Tree ====================
+// The monoid is a template parameter providing `identity()` and `combine(a, b)`
+// as static functions, so combine inlines at every node instead of going
+// through std::function. Iterative bottom-up layout: leaves at [n, 2n), node i
+// covers children 2i and 2i + 1, for 2n storage. combine only needs to be
+// associative; query keeps separate left/right accumulators so order holds.
+template<typename T>
+struct SumOp {
+    using value_type = T;
+    static T identity() { return T(0); }
+    static T combine(const T& a, const T& b) { return a + b; }
+};
+
+template<typename T>
+struct MinOp {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T combine(const T& a, const T& b) { return std::min(a, b); }
+};
+
+template<typename T>
+struct MaxOp {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T combine(const T& a, const T& b) { return std::max(a, b); }
+};
+
+template<typename T, typename Op>
+class MonoidSegmentTree {
+private:
+    std::vector<T> tree;
+    int n;
+
+public:
+    MonoidSegmentTree(const std::vector<T>& nums) : tree(2 * nums.size()), n(nums.size()) {
+        std::copy(nums.begin(), nums.end(), tree.begin() + n);
+        for (int i = n - 1; i > 0; i--) {
+            tree[i] = Op::combine(tree[2 * i], tree[2 * i + 1]);
+        }
+    }
+    
+    void update(int idx, T val) {
+        idx += n;
+        tree[idx] = std::move(val);
+        for (idx >>= 1; idx > 0; idx >>= 1) {
+            tree[idx] = Op::combine(tree[2 * idx], tree[2 * idx + 1]);
+        }
+    }
+    
+    // Inclusive range [l, r]
+    T query(int l, int r) const {
+        T left = Op::identity();
+        T right = Op::identity();
+        for (l += n, r += n + 1; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) left = Op::combine(left, tree[l++]);
+            if (r & 1) right = Op::combine(tree[--r], right);
+        }
+        return Op::combine(left, right);
+    }
+    
+    const T& get(int idx) const { return tree[idx + n]; }
+    int size() const { return n; }
+};
+
+// ==================== Segment Tree with Lazy Propagation ====================
+class LazySegmentTree {
+private:
+    std::vector<long long> tree;
+    std::vector<long long> lazy;
+    int n;
+    
+    void pushDown(int node, int start, int end) {
+        if (lazy[node] != 0) {
+            tree[node] += (end - start + 1) * lazy[node];
+            if (start != end) {
+                lazy[2 * node + 1] += lazy[node];
+                lazy[2 * node + 2] += lazy[node];
+            }
+            lazy[node] = 0;
+        }
+    }
+    
+    void build(const std::vector<int>& nums, int node, int start, int end) {
+        if (start == end) {
+            tree[node] = nums[start];
+        } else {
+            int mid = start + (end - start) / 2;
+            build(nums, 2 * node + 1, start, mid);
+            build(nums, 2 * node + 2, mid + 1, end);
+            tree[node] = tree[2 * node + 1] + tree[2 * node + 2];
+        }
+    }
+    
+    void rangeUpdateHelper(int node, int start, int end, int l, int r, long long val) {
+        pushDown(node, start, end);
+        
+        if (r < start || end < l) return;
+        
+        if (l <= start && end <= r) {
+            tree[node] += (end - start + 1) * val;
+            if (start != end) {
+                lazy[2 * node + 1] += val;
+                lazy[2 * node + 2] += val;
+            }
+            return;
+        }
+        
+        int mid = start + (end - start) / 2;
+        rangeUpdateHelper(2 * node + 1, start, mid, l, r, val);
+        rangeUpdateHelper(2 * node + 2, mid + 1, end, l, r, val);
+        tree[node] = tree[2 * node + 1] + tree[2 * node + 2];
+    }
+    
+    long long queryHelper(int node, int start, int end, int l, int r) {
+        pushDown(node, start, end);
+        
+        if (r < start || end < l) return 0;
+        if (l <= start && end <= r) return tree[node];
+        
+        int mid = start + (end - start) / 2;
+        return queryHelper(2 * node + 1, start, mid, l, r) +
+               queryHelper(2 * node + 2, mid + 1, end, l, r);
+    }
+
+public:
+    LazySegmentTree(const std::vector<int>& nums) : n(nums.size()) {
+        tree.resize(4 * n, 0);
+        lazy.resize(4 * n, 0);
+        build(nums, 0, 0, n - 1);
+    }
+    
+    void rangeUpdate(int l, int r, long long val) {
+        rangeUpdateHelper(0, 0, n - 1, l, r, val);
+    }
+    
+    long long query(int l, int r) {
+        return queryHelper(0, 0, n - 1, l, r);
+    }
+};
+
+// ==================== Generic Lazy Segment Tree ====================
+// Parameterized by a value monoid (value_type, identity, combine), a tag
+// monoid (value_type, identity, combine(newer, older) = composition) and an
+// Apply policy mapping a tag onto a node aggregate that covers `len` elements.
+// Non-recursive (AtCoder-style): tags are pushed only along the ancestors of
+// the range boundaries, never into nodes the range does not overlap.
+// Padding leaves past n have len 0 and are never tagged.
+template<typename Value, typename Tag, typename Apply>
+class GenericLazySegmentTree {
+public:
+    using T = typename Value::value_type;
+    using F = typename Tag::value_type;
+
+private:
+    int n;
+    int size;  // Leaves, power of two
+    int log;
+    std::vector<T> data;
+    std::vector<F> lazy;
+    std::vector<int> len;  // Real (non-padding) elements under each node
+    
+    void pull(int k) { data[k] = Value::combine(data[2 * k], data[2 * k + 1]); }
+    
+    void applyAt(int k, const F& f) {
+        if (len[k] == 0) return;
+        data[k] = Apply::apply(f, data[k], len[k]);
+        if (k < size) lazy[k] = Tag::combine(f, lazy[k]);
+    }
+    
+    void push(int k) {
+        applyAt(2 * k, lazy[k]);
+        applyAt(2 * k + 1, lazy[k]);
+        lazy[k] = Tag::identity();
+    }
+    
+    template<typename It>
+    void build(It first, It last) {
+        n = std::distance(first, last);
+        log = 0;
+        while ((1 << log) < n) log++;
+        size = 1 << log;
+        data.assign(2 * size, Value::identity());
+        lazy.assign(size, Tag::identity());
+        len.assign(2 * size, 0);
+        
+        int i = 0;
+        for (It it = first; it != last; ++it, ++i) {
+            data[size + i] = *it;
+            len[size + i] = 1;
+        }
+        for (int k = size - 1; k >= 1; k--) {
+            len[k] = len[2 * k] + len[2 * k + 1];
+            pull(k);
+        }
+    }
+
+public:
+    explicit GenericLazySegmentTree(int n) {
+        std::vector<T> init(n, Value::identity());
+        build(init.begin(), init.end());
+    }
+    
+    template<typename It>
+    GenericLazySegmentTree(It first, It last) {
+        build(first, last);
+    }
+    
+    GenericLazySegmentTree(const std::vector<T>& nums) {
+        build(nums.begin(), nums.end());
+    }
+    
+    void set(int p, T x) {
+        p += size;
+        for (int i = log; i >= 1; i--) push(p >> i);
+        data[p] = std::move(x);
+        for (int i = 1; i <= log; i++) pull(p >> i);
+    }
+    
+    T get(int p) {
+        p += size;
+        for (int i = log; i >= 1; i--) push(p >> i);
+        return data[p];
+    }
+    
+    // Aggregate over inclusive range [l, r]
+    T query(int l, int r) {
+        l += size;
+        r += size + 1;
+        for (int i = log; i >= 1; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        
+        T left = Value::identity(), right = Value::identity();
+        for (; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) left = Value::combine(left, data[l++]);
+            if (r & 1) right = Value::combine(data[--r], right);
+        }
+        return Value::combine(left, right);
+    }
+    
+    T queryAll() const { return data[1]; }
+    
+    // Apply tag f to every element of inclusive range [l, r]
+    void rangeApply(int l, int r, const F& f) {
+        l += size;
+        r += size + 1;
+        for (int i = log; i >= 1; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        
+        for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+            if (a & 1) applyAt(a++, f);
+            if (b & 1) applyAt(--b, f);
+        }
+        
+        for (int i = 1; i <= log; i++) {
+            if (((l >> i) << i) != l) pull(l >> i);
+            if (((r >> i) << i) != r) pull((r - 1) >> i);
+        }
+    }
+};
+
+// ---------- Ready-made tag monoids and apply policies ----------
+
+// Range add (tag = delta)
+template<typename T>
+struct AddTag {
+    using value_type = T;
+    static T identity() { return T(0); }
+    static T combine(const T& newer, const T& older) { return newer + older; }
+};
+
+template<typename T>
+struct AddToSum {
+    static T apply(const T& delta, const T& sum, int len) { return sum + delta * T(len); }
+};
+
+// Range assign (tag = optional value, nullopt = no pending assignment)
+template<typename T>
+struct AssignTag {
+    using value_type = std::optional<T>;
+    static value_type identity() { return std::nullopt; }
+    static value_type combine(const value_type& newer, const value_type& older) {
+        return newer ? newer : older;
+    }
+};
+
+template<typename T>
+struct AssignToMinMax {
+    static T apply(const std::optional<T>& f, const T& x, int) { return f ? *f : x; }
+};
+
+// Range affine x -> a * x + b
+template<typename T>
+struct Affine {
+    T a, b;
+};
+
+template<typename T>
+struct AffineTag {
+    using value_type = Affine<T>;
+    static Affine<T> identity() { return {T(1), T(0)}; }
+    // newer(older(x)) = newer.a * (older.a * x + older.b) + newer.b
+    static Affine<T> combine(const Affine<T>& newer, const Affine<T>& older) {
+        return {newer.a * older.a, newer.a * older.b + newer.b};
+    }
+};
+
+template<typename T>
+struct AffineToSum {
+    static T apply(const Affine<T>& f, const T& sum, int len) { return f.a * sum + f.b * T(len); }
+};
+
+template<typename T>
+using RangeAddSumTree = GenericLazySegmentTree<SumOp<T>, AddTag<T>, AddToSum<T>>;
+
+template<typename T>
+using RangeAssignMinTree = GenericLazySegmentTree<MinOp<T>, AssignTag<T>, AssignToMinMax<T>>;
+
+template<typename T>
+using RangeAffineSumTree = GenericLazySegmentTree<SumOp<T>, AffineTag<T>, AffineToSum<T>>;
+
+// ==================== Merge Sort Tree (for K-th smallest in range) ====================
+class MergeSortTree {
+private:
+    std::vector<std::vector<int>> tree;
+    int n;
+    
+    void build(const std::vector<int>& nums, int node, int start, int end) {
+        if (start == end) {
+            tree[node] = {nums[start]};
+        } else {
+            int mid = start + (end - start) / 2;
+            build(nums, 2 * node + 1, start, mid);
+            build(nums, 2 * node + 2, mid + 1, end);
+            
+            // Merge sorted arrays
+            std::merge(tree[2 * node + 1].begin(), tree[2 * node + 1].end(),
+                      tree[2 * node + 2].begin(), tree[2 * node + 2].end(),
+                      std::back_inserter(tree[node]));
+        }
+    }
+    
+    // Count elements <= val in range [l, r]
+    int countLessOrEqual(int node, int start, int end, int l, int r, int val) {
+        if (r < start || end < l) return 0;
+        if (l <= start && end <= r) {
+            return std::upper_bound(tree[node].begin(), tree[node].end(), val) - tree[node].begin();
+        }
+        
+        int mid = start + (end - start) / 2;
+        return countLessOrEqual(2 * node + 1, start, mid, l, r, val) +
+               countLessOrEqual(2 * node + 2, mid + 1, end, l, r, val);
+    }
+
+public:
+    MergeSortTree(const std::vector<int>& nums) : n(nums.size()) {
+        tree.resize(4 * n);
+        build(nums, 0, 0, n - 1);
+    }
+    
+    // Find k-th smallest element in range [l, r] (1-indexed k).
+    // The answer is one of the array's values, so binary search over the
+    // root's sorted list: log n probes instead of 32 over the int range.
+    int kthSmallest(int l, int r, int k) {
+        const std::vector<int>& sorted = tree[0];
+        int lo = 0, hi = n - 1;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (countLessOrEqual(0, 0, n - 1, l, r, sorted[mid]) < k) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return sorted[lo];
+    }
+    
+    int countInRange(int l, int r, int minVal, int maxVal) {
+        return countLessOrEqual(0, 0, n - 1, l, r, maxVal) - 
+               countLessOrEqual(0, 0, n - 1, l, r, minVal - 1);
+    }
+    
+    // Nodes that hold a list; the 4n slot array leaves the rest empty
+    size_t nodeCount() const {
+        return std::count_if(tree.begin(), tree.end(), [](const std::vector<int>& v) { return !v.empty(); });
+    }
+    
+    size_t memoryBytes() const {
+        size_t bytes = tree.capacity() * sizeof(std::vector<int>);
+        for (const std::vector<int>& v : tree) bytes += v.capacity() * sizeof(int);
+        return bytes;
+    }
+};
+
+// ==================== Wavelet Matrix ====================
+// Rank directory over a plain bitvector: one popcount prefix per 64-bit word,
+// so rank is O(1) and select is a binary search over words.
+class RankBitVector {
+private:
+    std::vector<uint64_t> words;
+    std::vector<uint32_t> ranks;  // ranks[w] = ones in words [0, w)
+    int n;
+
+public:
+    RankBitVector(int n = 0) : words((n + 63) / 64 + 1, 0), n(n) {}
+    
+    void set(int i) { words[i >> 6] |= 1ULL << (i & 63); }
+    
+    void buildRanks() {
+        ranks.assign(words.size() + 1, 0);
+        for (size_t w = 0; w < words.size(); w++) {
+            ranks[w + 1] = ranks[w] + __builtin_popcountll(words[w]);
+        }
+    }
+    
+    bool get(int i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+    
+    // Ones / zeros in [0, i)
+    int rank1(int i) const {
+        uint64_t mask = (1ULL << (i & 63)) - 1;
+        return ranks[i >> 6] + __builtin_popcountll(words[i >> 6] & mask);
+    }
+    int rank0(int i) const { return i - rank1(i); }
+    
+    // Position of the j-th (0-indexed) set / clear bit
+    int select1(int j) const {
+        int lo = 0, hi = words.size() - 1;
+        while (lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            if ((int)ranks[mid] <= j) lo = mid; else hi = mid - 1;
+        }
+        uint64_t w = words[lo];
+        for (int skip = j - ranks[lo]; skip > 0; skip--) w &= w - 1;
+        return lo * 64 + __builtin_ctzll(w);
+    }
+    
+    int select0(int j) const {
+        int lo = 0, hi = words.size() - 1;
+        while (lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            if (mid * 64 - (int)ranks[mid] <= j) lo = mid; else hi = mid - 1;
+        }
+        uint64_t w = ~words[lo];
+        for (int skip = j - (lo * 64 - (int)ranks[lo]); skip > 0; skip--) w &= w - 1;
+        return lo * 64 + __builtin_ctzll(w);
+    }
+};
+
+// Values are compressed to codes in [0, sigma); level b (from the top bit
+// down) keeps one bitvector of bit b of every code, stably partitioned with
+// zeros first. Every query walks the levels once: O(log sigma) rank calls and
+// about n * log(sigma) bits of storage plus the rank directory.
+class WaveletMatrix {
+private:
+    int n;
+    int bits;
+    std::vector<int> values;  // Sorted distinct values, code -> value
+    std::vector<RankBitVector> levels;
+    std::vector<int> zeros;   // Zero count per level
+    
+    int code(int value) const {
+        return std::lower_bound(values.begin(), values.end(), value) - values.begin();
+    }
+    
+    // Codes strictly less than c in the half-open range [l, r)
+    int countLessCode(int l, int r, int c) const {
+        if (c >= (1 << bits)) return r - l;
+        int count = 0;
+        for (int b = bits - 1; b >= 0; b--) {
+            const RankBitVector& bv = levels[b];
+            int zl = bv.rank0(l), zr = bv.rank0(r);
+            if ((c >> b) & 1) {
+                count += zr - zl;
+                l = zeros[b] + (l - zl);
+                r = zeros[b] + (r - zr);
+            } else {
+                l = zl;
+                r = zr;
+            }
+        }
+        return count;
+    }
+
+public:
+    WaveletMatrix(const std::vector<int>& nums) : n(nums.size()), bits(1) {
+        values = nums;
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        while ((1 << bits) < (int)values.size()) bits++;
+        
+        std::vector<int> current(n), next(n);
+        for (int i = 0; i < n; i++) current[i] = code(nums[i]);
+        
+        levels.resize(bits);
+        zeros.resize(bits);
+        for (int b = bits - 1; b >= 0; b--) {
+            RankBitVector bv(n);
+            int z = 0;
+            for (int i = 0; i < n; i++) {
+                if ((current[i] >> b) & 1) bv.set(i); else z++;
+            }
+            bv.buildRanks();
+            
+            int zi = 0, oi = z;
+            for (int i = 0; i < n; i++) {
+                if ((current[i] >> b) & 1) next[oi++] = current[i]; else next[zi++] = current[i];
+            }
+            current.swap(next);
+            levels[b] = std::move(bv);
+            zeros[b] = z;
+        }
+    }
+    
+    int access(int i) const {
+        int c = 0;
+        for (int b = bits - 1; b >= 0; b--) {
+            const RankBitVector& bv = levels[b];
+            if (bv.get(i)) {
+                c |= 1 << b;
+                i = zeros[b] + bv.rank1(i);
+            } else {
+                i = bv.rank0(i);
+            }
+        }
+        return values[c];
+    }
+    
+    // Occurrences of value in [0, i)
+    int rank(int value, int i) const {
+        int c = code(value);
+        if (c == (int)values.size() || values[c] != value) return 0;
+        
+        int l = 0, r = i;
+        for (int b = bits - 1; b >= 0; b--) {
+            const RankBitVector& bv = levels[b];
+            if ((c >> b) & 1) {
+                l = zeros[b] + bv.rank1(l);
+                r = zeros[b] + bv.rank1(r);
+            } else {
+                l = bv.rank0(l);
+                r = bv.rank0(r);
+            }
+        }
+        return r - l;
+    }
+    
+    // Index of the k-th (1-indexed) occurrence of value, -1 if there is none
+    int select(int value, int k) const {
+        if (k < 1 || rank(value, n) < k) return -1;
+        int c = code(value);
+        
+        // Start of c's block at the bottom level
+        int p = 0;
+        for (int b = bits - 1; b >= 0; b--) {
+            p = ((c >> b) & 1) ? zeros[b] + levels[b].rank1(p) : levels[b].rank0(p);
+        }
+        p += k - 1;
+        
+        for (int b = 0; b < bits; b++) {
+            p = ((c >> b) & 1) ? levels[b].select1(p - zeros[b]) : levels[b].select0(p);
+        }
+        return p;
+    }
+    
+    // k-th smallest (1-indexed k) in inclusive range [l, r]
+    int kthSmallest(int l, int r, int k) const {
+        r++;
+        k--;
+        int c = 0;
+        for (int b = bits - 1; b >= 0; b--) {
+            const RankBitVector& bv = levels[b];
+            int zl = bv.rank0(l), zr = bv.rank0(r);
+            if (k < zr - zl) {
+                l = zl;
+                r = zr;
+            } else {
+                k -= zr - zl;
+                c |= 1 << b;
+                l = zeros[b] + (l - zl);
+                r = zeros[b] + (r - zr);
+            }
+        }
+        return values[c];
+    }
+    
+    // Elements of [l, r] with minVal <= value <= maxVal
+    int countInRange(int l, int r, int minVal, int maxVal) const {
+        if (minVal > maxVal) return 0;
+        int hiCode = std::upper_bound(values.begin(), values.end(), maxVal) - values.begin();
+        return countLessCode(l, r + 1, hiCode) - countLessCode(l, r + 1, code(minVal));
+    }
+};
+
+// ==================== Sparse Table (O(1) static RMQ) ====================
+// For idempotent monoids (MinOp, MaxOp): level k holds combine over windows
+// of 2^k, and any range is covered by two overlapping windows.
+template<typename T, typename Op>
+class SparseTable {
+private:
+    std::vector<T> table;  // levels x n, flat
+    int n;
+    
+    static int floorLog2(int x) { return 31 - __builtin_clz(x); }
+
+public:
+    SparseTable(const std::vector<T>& nums) : n(nums.size()) {
+        int levels = n > 0 ? floorLog2(n) + 1 : 0;
+        table.resize((size_t)levels * n);
+        std::copy(nums.begin(), nums.end(), table.begin());
+        for (int k = 1; k < levels; k++) {
+            const T* prev = table.data() + (size_t)(k - 1) * n;
+            T* cur = table.data() + (size_t)k * n;
+            for (int i = 0; i + (1 << k) <= n; i++) {
+                cur[i] = Op::combine(prev[i], prev[i + (1 << (k - 1))]);
+            }
+        }
+    }
+    
+    // Inclusive range [l, r]
+    T query(int l, int r) const {
+        int k = floorLog2(r - l + 1);
+        const T* level = table.data() + (size_t)k * n;
+        return Op::combine(level[l], level[r - (1 << k) + 1]);
+    }
+};
+
+// ==================== Offline Batch Range Queries ====================
+
+using RangeQuery = std::pair<int, int>;  // Inclusive [l, r]
+
+namespace detail {
+
+// query(l, r) where the structure has one, else rangeSum(l, r) (the Fenwick
+// trees); the int/long argument makes the query overload win when both exist
+template<typename Structure>
+auto rangeQuery(const Structure& s, int l, int r, int) -> decltype(s.query(l, r)) {
+    return s.query(l, r);
+}
+
+template<typename Structure>
+auto rangeQuery(const Structure& s, int l, int r, long) -> decltype(s.rangeSum(l, r)) {
+    return s.rangeSum(l, r);
+}
+
+}  // namespace detail
+
+// Answers a batch against any structure with a const query(l, r) or
+// rangeSum(l, r): SegmentTree, MonoidSegmentTree, SparseTable,
+// BinaryIndexedTree. Queries are visited sorted by left endpoint so
+// neighbouring queries touch the same nodes (for a Fenwick tree, the same
+// prefix paths), split across `pool`, and returned in the caller's order.
+template<typename Structure>
+auto batchQuery(const Structure& structure, const std::vector<RangeQuery>& queries,
+                ThreadPool* pool = nullptr)
+    -> std::vector<decltype(detail::rangeQuery(structure, 0, 0, 0))> {
+    std::vector<int> order(queries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return queries[a] < queries[b]; });
+    
+    std::vector<decltype(detail::rangeQuery(structure, 0, 0, 0))> result(queries.size());
+    auto run = [&](size_t lo, size_t hi, unsigned) {
+        for (size_t i = lo; i < hi; i++) {
+            const RangeQuery& q = queries[order[i]];
+            result[order[i]] = detail::rangeQuery(structure, q.first, q.second, 0);
+        }
+    };
+    if (pool) {
+        pool->parallelFor(order.size(), 4096, run);
+    } else {
+        run(0, order.size(), 0);
+    }
+    return result;
+}
+
+// Mo's algorithm for window functions that only support add/remove of one
+// element (distinct count, mode frequency, ...). State must provide
+// add(i), remove(i) and answer(). Queries are ordered by (l / block, r) with
+// alternating r direction; the ordered list is cut into contiguous chunks,
+// each swept by one thread with its own State from makeState().
+template<typename MakeState>
+auto moQueries(int n, const std::vector<RangeQuery>& queries, MakeState makeState,
+               ThreadPool* pool = nullptr) -> std::vector<decltype(makeState().answer())> {
+    const int q = queries.size();
+    const int block = std::max(1, (int)(n / std::max(1.0, std::sqrt((double)q))));
+    
+    std::vector<int> order(q);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        int ba = queries[a].first / block, bb = queries[b].first / block;
+        if (ba != bb) return ba < bb;
+        return (ba & 1) ? queries[a].second > queries[b].second
+                        : queries[a].second < queries[b].second;
+    });
+    
+    std::vector<decltype(makeState().answer())> result(q);
+    auto sweep = [&](size_t lo, size_t hi, unsigned) {
+        auto state = makeState();
+        int curL = 0, curR = -1;  // Current window [curL, curR]
+        for (size_t i = lo; i < hi; i++) {
+            auto [l, r] = queries[order[i]];
+            while (curR < r) state.add(++curR);
+            while (curL > l) state.add(--curL);
+            while (curR > r) state.remove(curR--);
+            while (curL < l) state.remove(curL++);
+            result[order[i]] = state.answer();
+        }
+    };
+    
+    if (pool && pool->size() > 1) {
+        // Few large chunks: each chunk pays one cold window build
+        size_t chunk = (q + 4 * pool->size() - 1) / (4 * pool->size());
+        pool->parallelFor(q, chunk, sweep);
+    } else {
+        sweep(0, q, 0);
+    }
+    return result;
+}
+
+#endif  // DSA_SEGMENT_TREE_H
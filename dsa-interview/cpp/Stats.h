@@ -0,0 +1,433 @@
+/**
+ * Opt-in Instrumentation (counters, latency histograms, Prometheus export)
+ *
+ * Build with -DDSA_STATS=1 (CMake: -DDSA_STATS=ON) to compile the counters in.
+ * Without it every DSA_STAT(...) expands to nothing: instrumented structures
+ * carry no extra members and their hot paths are unchanged.
+ *
+ * - Counter / SharedCounter: relaxed atomics a scraper may read at any time
+ * - LatencyHistogram: log-linear buckets counted in an AtomicBinaryIndexedTree,
+ *   so cumulative bucket counts and quantiles are O(log buckets)
+ * - Exposition: Prometheus text format, grouped by metric family
+ * - Registry: named sources, scrape() renders all of them
+ *
+ * Shared by LRUCache.h, Graph.h and Trie.h; exportMemory() takes any
+ * structure with nodeCount() and memoryBytes(). The arena tries and
+ * MergeSortTree always have them; Trie and XORTrie only with DSA_STATS.
+ */
+
+#ifndef DSA_STATS_H
+#define DSA_STATS_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BinaryIndexedTree.h"
+
+#if defined(DSA_STATS) && DSA_STATS
+#define DSA_STATS_ENABLED 1
+#define DSA_STAT(...) __VA_ARGS__
+#define DSA_STAT_PTR(counters) (&(counters))
+#else
+#define DSA_STATS_ENABLED 0
+#define DSA_STAT(...)
+#define DSA_STAT_PTR(counters) nullptr
+#endif
+
+#define DSA_STAT_CONCAT_(a, b) a##b
+#define DSA_STAT_CONCAT(a, b) DSA_STAT_CONCAT_(a, b)
+
+// Records the time until the end of the enclosing scope into `histogram`
+#define DSA_STAT_LATENCY(histogram) \
+    DSA_STAT(::stats::ScopedLatency DSA_STAT_CONCAT(dsaStatLatency, __LINE__)(histogram))
+
+namespace stats {
+
+constexpr bool ENABLED = DSA_STATS_ENABLED;
+
+// ==================== Counters ====================
+// Counters belong to one instance: a copy starts from zero.
+
+// Single writer (the thread that owns the structure): a relaxed load + store,
+// no locked instruction. Any thread may read it.
+class Counter {
+private:
+    std::atomic<uint64_t> count;
+
+public:
+    Counter() : count(0) {}
+    Counter(const Counter&) : count(0) {}
+    Counter& operator=(const Counter&) { return *this; }
+
+    void add(uint64_t delta = 1) {
+        count.store(count.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const { return count.load(std::memory_order_relaxed); }
+};
+
+// Several writers, e.g. const graph searches running on different threads
+class SharedCounter {
+private:
+    std::atomic<uint64_t> count;
+
+public:
+    SharedCounter() : count(0) {}
+    SharedCounter(const SharedCounter&) : count(0) {}
+    SharedCounter& operator=(const SharedCounter&) { return *this; }
+
+    void add(uint64_t delta = 1) { count.fetch_add(delta, std::memory_order_relaxed); }
+
+    uint64_t value() const { return count.load(std::memory_order_relaxed); }
+};
+
+// ==================== Latency Histogram ====================
+// Nanosecond values in log-linear buckets: values below 4 get their own
+// bucket, then every power of two is split into 4 equal sub-buckets (<= 25%
+// relative error). The last bucket also takes everything above ~2^41 ns.
+class LatencyHistogram {
+public:
+    static const int SUB_BITS = 2;
+    static const int SUBS = 1 << SUB_BITS;
+    static const int BUCKETS = 40 * SUBS;
+
+private:
+    AtomicBinaryIndexedTree<long long> counts;
+    std::atomic<uint64_t> totalNanos;
+
+public:
+    LatencyHistogram() : counts(BUCKETS), totalNanos(0) {}
+    LatencyHistogram(const LatencyHistogram&) : LatencyHistogram() {}
+    LatencyHistogram& operator=(const LatencyHistogram&) { return *this; }
+
+    static int bucketOf(uint64_t nanos) {
+        if (nanos < SUBS) return (int)nanos;
+        int octave = 63 - __builtin_clzll(nanos);
+        int bucket = (octave - SUB_BITS + 1) * SUBS + (int)((nanos >> (octave - SUB_BITS)) & (SUBS - 1));
+        return std::min(bucket, BUCKETS - 1);
+    }
+
+    // Largest value (inclusive) that falls into `bucket`
+    static uint64_t upperBound(int bucket) {
+        if (bucket < SUBS) return bucket;
+        int shift = bucket / SUBS - 1;
+        uint64_t lower = (uint64_t)(SUBS + bucket % SUBS) << shift;
+        return lower + (1ULL << shift) - 1;
+    }
+
+    void record(uint64_t nanos) {
+        counts.update(bucketOf(nanos), 1);
+        totalNanos.fetch_add(nanos, std::memory_order_relaxed);
+    }
+
+    void record(std::chrono::nanoseconds elapsed) { record((uint64_t)std::max<int64_t>(elapsed.count(), 0)); }
+
+    uint64_t count() const { return counts.prefixSum(BUCKETS - 1); }
+    uint64_t sumNanos() const { return totalNanos.load(std::memory_order_relaxed); }
+
+    // Samples recorded in buckets [0, bucket]
+    uint64_t cumulative(int bucket) const { return counts.prefixSum(bucket); }
+
+    // Upper bound of the bucket holding the ceil(q * count)-th sample, 0 if empty
+    uint64_t quantileNanos(double q) const {
+        long long total = count();
+        if (total == 0) return 0;
+        long long rank = std::max(1LL, std::min(total, (long long)std::ceil(q * total)));
+        return upperBound(std::min(counts.lowerBound(rank), BUCKETS - 1));
+    }
+};
+
+class ScopedLatency {
+private:
+    LatencyHistogram& histogram;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedLatency(LatencyHistogram& histogram)
+        : histogram(histogram), start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedLatency() { histogram.record(std::chrono::steady_clock::now() - start); }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+};
+
+// ==================== Prometheus Exposition ====================
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+// Samples are grouped per metric family (one # TYPE line each), as the text
+// format requires, no matter in which order sources emit them.
+class Exposition {
+private:
+    struct Family {
+        std::string name;
+        std::string help;
+        std::string type;
+        std::string samples;
+    };
+
+    std::vector<Family> families;
+    std::unordered_map<std::string, size_t> index;
+
+    Family& family(const std::string& name, const std::string& help, const char* type) {
+        auto it = index.find(name);
+        if (it != index.end()) return families[it->second];
+        index.emplace(name, families.size());
+        families.push_back(Family{name, help, type, {}});
+        return families.back();
+    }
+
+    static void appendLabels(std::string& out, const Labels& labels, const char* extraName = nullptr,
+                             const std::string& extraValue = std::string()) {
+        if (labels.empty() && !extraName) return;
+        out += '{';
+        bool first = true;
+        auto add = [&](const std::string& name, const std::string& value) {
+            if (!first) out += ',';
+            first = false;
+            out += name;
+            out += "=\"";
+            for (char c : value) {
+                if (c == '\\' || c == '"') out += '\\';
+                if (c == '\n') {
+                    out += "\\n";
+                    continue;
+                }
+                out += c;
+            }
+            out += '"';
+        };
+        for (auto& [name, value] : labels) add(name, value);
+        if (extraName) add(extraName, extraValue);
+        out += '}';
+    }
+
+    // Integers print exactly, fractions (latency bounds, ratios) with 9 digits
+    static std::string number(double value) {
+        char buffer[32];
+        if (value == std::floor(value) && std::fabs(value) < 9007199254740992.0) {
+            std::snprintf(buffer, sizeof(buffer), "%.0f", value);
+        } else {
+            std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+        }
+        return buffer;
+    }
+
+    static void appendSample(std::string& out, const std::string& name, const Labels& labels,
+                             const std::string& value, const char* extraName = nullptr,
+                             const std::string& extraValue = std::string()) {
+        out += name;
+        appendLabels(out, labels, extraName, extraValue);
+        out += ' ';
+        out += value;
+        out += '\n';
+    }
+
+public:
+    void counter(const std::string& name, const std::string& help, const Labels& labels, uint64_t value) {
+        appendSample(family(name, help, "counter").samples, name, labels, std::to_string(value));
+    }
+
+    void gauge(const std::string& name, const std::string& help, const Labels& labels, double value) {
+        appendSample(family(name, help, "gauge").samples, name, labels, number(value));
+    }
+
+    // Exported in seconds with one `le` bound per power of two
+    void histogram(const std::string& name, const std::string& help, const Labels& labels,
+                   const LatencyHistogram& h) {
+        std::string& out = family(name, help, "histogram").samples;
+        for (int b = LatencyHistogram::SUBS - 1; b < LatencyHistogram::BUCKETS - 1; b += LatencyHistogram::SUBS) {
+            appendSample(out, name + "_bucket", labels, std::to_string(h.cumulative(b)),
+                         "le", number(LatencyHistogram::upperBound(b) * 1e-9));
+        }
+        uint64_t count = h.count();
+        appendSample(out, name + "_bucket", labels, std::to_string(count), "le", "+Inf");
+        appendSample(out, name + "_sum", labels, number(h.sumNanos() * 1e-9));
+        appendSample(out, name + "_count", labels, std::to_string(count));
+    }
+
+    std::string str() const {
+        std::string out;
+        for (const Family& f : families) {
+            out += "# HELP " + f.name + " " + f.help + "\n";
+            out += "# TYPE " + f.name + " " + f.type + "\n";
+            out += f.samples;
+        }
+        return out;
+    }
+};
+
+// ==================== Registry ====================
+// Sources are callbacks that write into an Exposition; the Handle returned by
+// add() unregisters on destruction, so a source can't outlive its structure.
+// Structures aren't internally synchronized: register sources that read them
+// from the owning thread, or under the structure's own lock.
+class Registry {
+private:
+    std::mutex mtx;
+    std::map<uint64_t, std::function<void(Exposition&)>> sources;
+    uint64_t nextId = 0;
+
+public:
+    class Handle {
+    private:
+        Registry* registry;
+        uint64_t id;
+
+    public:
+        Handle() : registry(nullptr), id(0) {}
+        Handle(Registry* registry, uint64_t id) : registry(registry), id(id) {}
+        Handle(Handle&& other) : registry(other.registry), id(other.id) { other.registry = nullptr; }
+        Handle& operator=(Handle&& other) {
+            if (this != &other) {
+                reset();
+                registry = other.registry;
+                id = other.id;
+                other.registry = nullptr;
+            }
+            return *this;
+        }
+        ~Handle() { reset(); }
+
+        void reset() {
+            if (registry) registry->remove(id);
+            registry = nullptr;
+        }
+    };
+
+    Handle add(std::function<void(Exposition&)> source) {
+        std::lock_guard<std::mutex> lock(mtx);
+        sources.emplace(nextId, std::move(source));
+        return Handle(this, nextId++);
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mtx);
+        sources.erase(id);
+    }
+
+    // Prometheus text for every registered source
+    std::string scrape() {
+        Exposition out;
+        std::lock_guard<std::mutex> lock(mtx);
+        for (auto& [id, source] : sources) source(out);
+        return out.str();
+    }
+};
+
+inline Registry& registry() {
+    static Registry global;
+    return global;
+}
+
+// ==================== Structure Stats ====================
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;    // Capacity evictions
+    uint64_t expirations = 0;  // TTL expiries
+    uint64_t probes = 0;       // Open-addressing slots inspected (slab caches)
+    size_t size = 0;
+    size_t capacity = 0;
+    bool counted = false;      // False when the counters were compiled out
+    
+    // Counters only some cache types have; exportCache skips the rest rather
+    // than publishing series that are zero by construction
+    static constexpr unsigned EXPIRATIONS = 1, PROBES = 2;
+    unsigned present = 0;
+    
+    bool has(unsigned field) const { return (present & field) != 0; }
+
+    double hitRatio() const { return hits + misses ? (double)hits / (hits + misses) : 0.0; }
+};
+
+struct CacheCounters {
+    Counter hits, misses, evictions, expirations;
+
+    // counters is null when DSA_STATS is off (see DSA_STAT_PTR); present is a
+    // mask of CacheStats::EXPIRATIONS / PROBES
+    static CacheStats snapshot(const CacheCounters* counters, size_t size, size_t capacity,
+                               unsigned present = 0, uint64_t probes = 0) {
+        CacheStats s;
+        s.present = present;
+        if (counters) {
+            s.counted = true;
+            s.hits = counters->hits.value();
+            s.misses = counters->misses.value();
+            s.evictions = counters->evictions.value();
+            s.expirations = counters->expirations.value();
+            s.probes = probes;
+        }
+        s.size = size;
+        s.capacity = capacity;
+        return s;
+    }
+};
+
+inline void exportCache(Exposition& out, const Labels& labels, const CacheStats& s) {
+    if (s.counted) {
+        out.counter("dsa_cache_hits_total", "Cache lookups that found the key", labels, s.hits);
+        out.counter("dsa_cache_misses_total", "Cache lookups that missed", labels, s.misses);
+        out.counter("dsa_cache_evictions_total", "Entries evicted to make room", labels, s.evictions);
+        if (s.has(CacheStats::EXPIRATIONS)) {
+            out.counter("dsa_cache_expirations_total", "Entries dropped after their TTL", labels, s.expirations);
+        }
+        if (s.has(CacheStats::PROBES)) {
+            out.counter("dsa_cache_probes_total", "Hash slots inspected by open-addressing lookups", labels,
+                        s.probes);
+        }
+    }
+    out.gauge("dsa_cache_entries", "Entries currently cached", labels, s.size);
+    out.gauge("dsa_cache_capacity", "Maximum entries", labels, s.capacity);
+}
+
+// Any structure with nodeCount() and memoryBytes()
+template<typename Structure>
+void exportMemory(Exposition& out, const Labels& labels, const Structure& structure) {
+    out.gauge("dsa_nodes", "Live nodes", labels, structure.nodeCount());
+    out.gauge("dsa_memory_bytes", "Bytes held, including allocator-visible capacity", labels,
+              structure.memoryBytes());
+}
+
+// Shortest-path runs (dijkstra, bellmanFord). Searches count into locals and
+// flush once per run, so concurrent const searches only share one fetch_add
+// per counter per run.
+struct SearchCounters {
+    SharedCounter runs, relaxations, improvements, heapPushes, stalePops;
+    LatencyHistogram latency;
+
+    void flush(uint64_t relaxed, uint64_t improved, uint64_t pushed, uint64_t stale) {
+        runs.add();
+        relaxations.add(relaxed);
+        improvements.add(improved);
+        heapPushes.add(pushed);
+        stalePops.add(stale);
+    }
+
+    void exportTo(Exposition& out, const Labels& labels) const {
+        out.counter("dsa_search_runs_total", "Shortest-path searches run", labels, runs.value());
+        out.counter("dsa_search_relaxations_total", "Edges relaxed", labels, relaxations.value());
+        out.counter("dsa_search_improvements_total", "Relaxations that lowered a distance", labels,
+                    improvements.value());
+        out.counter("dsa_search_heap_pushes_total", "Queue inserts and decrease-keys", labels,
+                    heapPushes.value());
+        out.counter("dsa_search_stale_pops_total", "Outdated queue entries skipped", labels,
+                    stalePops.value());
+        out.histogram("dsa_search_duration_seconds", "Wall time per search", labels, latency);
+    }
+};
+
+}  // namespace stats
+
+#endif  // DSA_STATS_H
@@ -0,0 +1,109 @@
+/**
+ * Fixed-size Thread Pool for data-parallel loops in C++
+ *
+ * parallelFor(n, grain, fn) hands out chunks of [0, n) dynamically to the
+ * workers and to the calling thread, and returns once every chunk is done.
+ * Calls must not be nested and must not overlap from several threads.
+ *
+ * Shared by the parallel graph, range-query and selection kernels.
+ */
+
+#ifndef DSA_THREAD_POOL_H
+#define DSA_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::function<void(unsigned)> task;  // Receives the worker index
+    uint64_t generation;
+    unsigned active;
+    bool stopping;
+
+    void workerLoop(unsigned index) {
+        uint64_t seen = 0;
+        while (true) {
+            std::function<void(unsigned)>* current;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+                current = &task;
+            }
+
+            (*current)(index);
+
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--active == 0) done.notify_one();
+        }
+    }
+
+public:
+    // `threads` counts the calling thread, so ThreadPool(1) runs inline
+    explicit ThreadPool(unsigned threads = std::max(1u, std::thread::hardware_concurrency()))
+        : generation(0), active(0), stopping(false) {
+        for (unsigned i = 1; i < std::max(threads, 1u); i++) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return workers.size() + 1; }
+
+    // Runs fn(begin, end, worker) over chunks of at most `grain` indices,
+    // where worker is in [0, size()) and unique per running thread
+    template<typename F>
+    void parallelFor(size_t n, size_t grain, F&& fn) {
+        if (n == 0) return;
+        grain = std::max<size_t>(grain, 1);
+        if (workers.empty() || n <= grain) {
+            fn(size_t(0), n, 0u);
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        auto body = [&](unsigned worker) {
+            for (size_t lo = next.fetch_add(grain); lo < n; lo = next.fetch_add(grain)) {
+                fn(lo, std::min(lo + grain, n), worker);
+            }
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            task = body;
+            active = workers.size();
+            generation++;
+        }
+        wake.notify_all();
+
+        body(0);
+
+        std::unique_lock<std::mutex> lock(mtx);
+        done.wait(lock, [&] { return active == 0; });
+    }
+};
+
+#endif  // DSA_THREAD_POOL_H
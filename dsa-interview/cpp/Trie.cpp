@@ -11,227 +11,8 @@
  */
 
 #include <iostream>
-#include <string>
-#include <vector>
-#include <memory>
 
-class Trie {
-private:
-    static const int ALPHABET_SIZE = 26;
-    
-    struct TrieNode {
-        std::unique_ptr<TrieNode> children[ALPHABET_SIZE];
-        bool isEndOfWord;
-        int prefixCount;
-        int wordCount;
-        
-        TrieNode() : isEndOfWord(false), prefixCount(0), wordCount(0) {
-            for (int i = 0; i < ALPHABET_SIZE; i++) {
-                children[i] = nullptr;
-            }
-        }
-    };
-    
-    std::unique_ptr<TrieNode> root;
-    
-    TrieNode* searchNode(const std::string& word) {
-        TrieNode* current = root.get();
-        for (char c : word) {
-            int index = c - 'a';
-            if (!current->children[index]) {
-                return nullptr;
-            }
-            current = current->children[index].get();
-        }
-        return current;
-    }
-    
-    bool isEmpty(TrieNode* node) {
-        for (int i = 0; i < ALPHABET_SIZE; i++) {
-            if (node->children[i]) return false;
-        }
-        return true;
-    }
-    
-    bool deleteHelper(TrieNode* current, const std::string& word, int index) {
-        if (index == word.length()) {
-            if (!current->isEndOfWord) return false;
-            current->isEndOfWord = false;
-            current->wordCount--;
-            return isEmpty(current);
-        }
-        
-        int charIndex = word[index] - 'a';
-        if (!current->children[charIndex]) return false;
-        
-        current->children[charIndex]->prefixCount--;
-        bool shouldDeleteChild = deleteHelper(current->children[charIndex].get(), word, index + 1);
-        
-        if (shouldDeleteChild) {
-            current->children[charIndex].reset();
-            return isEmpty(current) && !current->isEndOfWord;
-        }
-        return false;
-    }
-    
-    bool searchWithWildcardHelper(TrieNode* node, const std::string& word, int index) {
-        if (index == word.length()) {
-            return node->isEndOfWord;
-        }
-        
-        char c = word[index];
-        if (c == '.') {
-            for (int i = 0; i < ALPHABET_SIZE; i++) {
-                if (node->children[i] && 
-                    searchWithWildcardHelper(node->children[i].get(), word, index + 1)) {
-                    return true;
-                }
-            }
-            return false;
-        } else {
-            int charIndex = c - 'a';
-            if (!node->children[charIndex]) return false;
-            return searchWithWildcardHelper(node->children[charIndex].get(), word, index + 1);
-        }
-    }
-    
-    void collectWords(TrieNode* node, std::string& prefix, std::vector<std::string>& result) {
-        if (node->isEndOfWord) {
-            result.push_back(prefix);
-        }
-        for (int i = 0; i < ALPHABET_SIZE; i++) {
-            if (node->children[i]) {
-                prefix.push_back('a' + i);
-                collectWords(node->children[i].get(), prefix, result);
-                prefix.pop_back();
-            }
-        }
-    }
-
-public:
-    Trie() : root(std::make_unique<TrieNode>()) {}
-    
-    void insert(const std::string& word) {
-        if (word.empty()) return;
-        
-        TrieNode* current = root.get();
-        for (char c : word) {
-            int index = c - 'a';
-            if (!current->children[index]) {
-                current->children[index] = std::make_unique<TrieNode>();
-            }
-            current = current->children[index].get();
-            current->prefixCount++;
-        }
-        current->isEndOfWord = true;
-        current->wordCount++;
-    }
-    
-    bool search(const std::string& word) {
-        TrieNode* node = searchNode(word);
-        return node != nullptr && node->isEndOfWord;
-    }
-    
-    bool startsWith(const std::string& prefix) {
-        return searchNode(prefix) != nullptr;
-    }
-    
-    int countWordsWithPrefix(const std::string& prefix) {
-        TrieNode* node = searchNode(prefix);
-        return node ? node->prefixCount : 0;
-    }
-    
-    int countExactWord(const std::string& word) {
-        TrieNode* node = searchNode(word);
-        return node ? node->wordCount : 0;
-    }
-    
-    bool deleteWord(const std::string& word) {
-        if (!search(word)) return false;
-        deleteHelper(root.get(), word, 0);
-        return true;
-    }
-    
-    bool searchWithWildcard(const std::string& word) {
-        return searchWithWildcardHelper(root.get(), word, 0);
-    }
-    
-    std::vector<std::string> getWordsWithPrefix(const std::string& prefix) {
-        std::vector<std::string> result;
-        TrieNode* node = searchNode(prefix);
-        if (node) {
-            std::string current = prefix;
-            collectWords(node, current, result);
-        }
-        return result;
-    }
-};
-
-// ==================== XOR Trie for Maximum XOR Problems ====================
-class XORTrie {
-private:
-    static const int MAX_BITS = 31;
-    
-    struct TrieNode {
-        std::unique_ptr<TrieNode> children[2];
-        int count;
-        
-        TrieNode() : count(0) {
-            children[0] = nullptr;
-            children[1] = nullptr;
-        }
-    };
-    
-    std::unique_ptr<TrieNode> root;
-
-public:
-    XORTrie() : root(std::make_unique<TrieNode>()) {}
-    
-    void insert(int num) {
-        TrieNode* current = root.get();
-        for (int i = MAX_BITS; i >= 0; i--) {
-            int bit = (num >> i) & 1;
-            if (!current->children[bit]) {
-                current->children[bit] = std::make_unique<TrieNode>();
-            }
-            current = current->children[bit].get();
-            current->count++;
-        }
-    }
-    
-    void remove(int num) {
-        TrieNode* current = root.get();
-        for (int i = MAX_BITS; i >= 0; i--) {
-            int bit = (num >> i) & 1;
-            if (current->children[bit]) {
-                current = current->children[bit].get();
-                current->count--;
-            }
-        }
-    }
-    
-    // Find maximum XOR with given number
-    int getMaxXOR(int num) {
-        TrieNode* current = root.get();
-        int maxXor = 0;
-        
-        for (int i = MAX_BITS; i >= 0; i--) {
-            int bit = (num >> i) & 1;
-            int oppositeBit = 1 - bit;
-            
-            // Try to go opposite direction for max XOR
-            if (current->children[oppositeBit] && current->children[oppositeBit]->count > 0) {
-                maxXor |= (1 << i);
-                current = current->children[oppositeBit].get();
-            } else if (current->children[bit] && current->children[bit]->count > 0) {
-                current = current->children[bit].get();
-            } else {
-                break;
-            }
-        }
-        return maxXor;
-    }
-};
+#include "Trie.h"
 
 int main() {
     Trie trie;
@@ -254,6 +35,38 @@ int main() {
     }
     std::cout << std::endl;
     
+    // Compact and double-array tries
+    CompactTrie compact;
+    for (const char* word : {"apple", "app", "application", "apply"}) compact.insert(word);
+    DoubleArrayTrie frozen(compact);
+    std::cout << "Compact words with prefix 'app': " << compact.countWordsWithPrefix("app") << std::endl; // 4
+    std::cout << "Frozen search 'appl': " << (frozen.search("appl") ? "true" : "false") << std::endl;     // false
+    std::cout << "Frozen startsWith 'appli': " << (frozen.startsWith("appli") ? "true" : "false") << std::endl; // true
+    std::cout << "Compact nodes: " << compact.nodeCount() << ", bytes: " << compact.memoryBytes() << std::endl;
+    
+    // Radix trie over raw bytes
+    RadixTrie radix;
+    for (const char* key : {"https://a.io/x", "https://a.io/y", "https://b.io", "cr\xc3\xa8me"}) {
+        radix.insert(key);
+    }
+    std::cout << "Radix prefix 'https://a': " << radix.countWordsWithPrefix("https://a") << std::endl; // 2
+    std::cout << "Radix search 'cr\xc3\xa8me': " << (radix.search("cr\xc3\xa8me") ? "true" : "false") << std::endl;
+    std::cout << "Radix words under 'https://': ";
+    for (const auto& key : radix.getWordsWithPrefix("https://")) std::cout << key << " ";
+    std::cout << "(" << radix.nodeCount() << " nodes)" << std::endl;
+    
+    // Weighted top-K autocomplete
+    AutocompleteTrie typeahead(3);
+    typeahead.insert("apple", 50);
+    typeahead.insert("app", 80);
+    typeahead.insert("application", 30);
+    typeahead.insert("apply", 65);
+    typeahead.insert("banana", 90);
+    typeahead.insert("app", 20);  // Re-weighting drops "app" below "apply" and "apple"
+    std::cout << "Top 3 for 'ap': ";
+    for (const auto& [word, weight] : typeahead.topK("ap", 3)) std::cout << word << "(" << weight << ") ";
+    std::cout << std::endl;  // apply(65) apple(50) application(30)
+    
     // XOR Trie demo
     XORTrie xorTrie;
     std::vector<int> nums = {3, 10, 5, 25, 2, 8};
@@ -267,5 +80,19 @@ int main() {
     }
     std::cout << "Maximum XOR in array: " << maxXor << std::endl; // Should be 28 (5 XOR 25)
     
+    // Flat XOR tries: bulk build, batched queries, 64-bit keys
+    std::vector<uint32_t> sortedNums = {2, 3, 5, 8, 10, 25};
+    FlatXORTrie<> flat(sortedNums);
+    uint32_t flatMax = 0;
+    for (uint32_t best : flat.getMaxXOR(sortedNums)) flatMax = std::max(flatMax, best);
+    std::cout << "Flat trie maximum XOR: " << flatMax << std::endl;  // 28
+    flat.remove(25);
+    std::cout << "After removing 25: " << flat.getMaxXOR(5u) << ", live nodes: " << flat.nodeCount() << std::endl; // 15 (5 ^ 10)
+    
+    FlatXORTrie<uint64_t> wide;
+    wide.insert(0xFFFF000000000000ULL);
+    wide.insert(0x0000FFFF00000000ULL);
+    std::cout << "64-bit max XOR: 0x" << std::hex << wide.getMaxXOR(0ULL) << std::dec << std::endl;  // 0xffff000000000000
+    
     return 0;
 }
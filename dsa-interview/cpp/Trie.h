@@ -0,0 +1,955 @@
+/**
+ * Trie (Prefix Tree) Implementation in C++
+ * 
+ * Time Complexity:
+ * - Insert: O(m) where m is the length of the word
+ * - Search: O(m)
+ * - StartsWith: O(m)
+ * - Delete: O(m)
+ * 
+ * Space Complexity: O(ALPHABET_SIZE * m * n) where n is number of words
+ * 
+ * Shared by Trie.cpp and the bench/ suite.
+ */
+
+#ifndef DSA_TRIE_H
+#define DSA_TRIE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include <deque>
+#include <type_traits>
+
+#include "Stats.h"
+
+class Trie {
+private:
+    static const int ALPHABET_SIZE = 26;
+    
+    struct TrieNode {
+        std::unique_ptr<TrieNode> children[ALPHABET_SIZE];
+        bool isEndOfWord;
+        int prefixCount;
+        int wordCount;
+        
+        TrieNode() : isEndOfWord(false), prefixCount(0), wordCount(0) {
+            for (int i = 0; i < ALPHABET_SIZE; i++) {
+                children[i] = nullptr;
+            }
+        }
+    };
+    
+    std::unique_ptr<TrieNode> root;
+    DSA_STAT(size_t nodes = 1;)  // Live nodes, root included
+    
+    TrieNode* searchNode(const std::string& word) {
+        TrieNode* current = root.get();
+        for (char c : word) {
+            int index = c - 'a';
+            if (!current->children[index]) {
+                return nullptr;
+            }
+            current = current->children[index].get();
+        }
+        return current;
+    }
+    
+    bool isEmpty(TrieNode* node) {
+        for (int i = 0; i < ALPHABET_SIZE; i++) {
+            if (node->children[i]) return false;
+        }
+        return true;
+    }
+    
+    bool deleteHelper(TrieNode* current, const std::string& word, int index) {
+        if (index == word.length()) {
+            if (!current->isEndOfWord) return false;
+            current->isEndOfWord = false;
+            current->wordCount--;
+            return isEmpty(current);
+        }
+        
+        int charIndex = word[index] - 'a';
+        if (!current->children[charIndex]) return false;
+        
+        current->children[charIndex]->prefixCount--;
+        bool shouldDeleteChild = deleteHelper(current->children[charIndex].get(), word, index + 1);
+        
+        if (shouldDeleteChild) {
+            current->children[charIndex].reset();
+            DSA_STAT(nodes--;)
+            return isEmpty(current) && !current->isEndOfWord;
+        }
+        return false;
+    }
+    
+    bool searchWithWildcardHelper(TrieNode* node, const std::string& word, int index) {
+        if (index == word.length()) {
+            return node->isEndOfWord;
+        }
+        
+        char c = word[index];
+        if (c == '.') {
+            for (int i = 0; i < ALPHABET_SIZE; i++) {
+                if (node->children[i] && 
+                    searchWithWildcardHelper(node->children[i].get(), word, index + 1)) {
+                    return true;
+                }
+            }
+            return false;
+        } else {
+            int charIndex = c - 'a';
+            if (!node->children[charIndex]) return false;
+            return searchWithWildcardHelper(node->children[charIndex].get(), word, index + 1);
+        }
+    }
+    
+    void collectWords(TrieNode* node, std::string& prefix, std::vector<std::string>& result) {
+        if (node->isEndOfWord) {
+            result.push_back(prefix);
+        }
+        for (int i = 0; i < ALPHABET_SIZE; i++) {
+            if (node->children[i]) {
+                prefix.push_back('a' + i);
+                collectWords(node->children[i].get(), prefix, result);
+                prefix.pop_back();
+            }
+        }
+    }
+
+public:
+    Trie() : root(std::make_unique<TrieNode>()) {}
+    
+    void insert(const std::string& word) {
+        if (word.empty()) return;
+        
+        TrieNode* current = root.get();
+        for (char c : word) {
+            int index = c - 'a';
+            if (!current->children[index]) {
+                current->children[index] = std::make_unique<TrieNode>();
+                DSA_STAT(nodes++;)
+            }
+            current = current->children[index].get();
+            current->prefixCount++;
+        }
+        current->isEndOfWord = true;
+        current->wordCount++;
+    }
+    
+    bool search(const std::string& word) {
+        TrieNode* node = searchNode(word);
+        return node != nullptr && node->isEndOfWord;
+    }
+    
+    bool startsWith(const std::string& prefix) {
+        return searchNode(prefix) != nullptr;
+    }
+    
+    int countWordsWithPrefix(const std::string& prefix) {
+        TrieNode* node = searchNode(prefix);
+        return node ? node->prefixCount : 0;
+    }
+    
+    int countExactWord(const std::string& word) {
+        TrieNode* node = searchNode(word);
+        return node ? node->wordCount : 0;
+    }
+    
+    bool deleteWord(const std::string& word) {
+        if (!search(word)) return false;
+        deleteHelper(root.get(), word, 0);
+        return true;
+    }
+    
+    bool searchWithWildcard(const std::string& word) {
+        return searchWithWildcardHelper(root.get(), word, 0);
+    }
+    
+    std::vector<std::string> getWordsWithPrefix(const std::string& prefix) {
+        std::vector<std::string> result;
+        TrieNode* node = searchNode(prefix);
+        if (node) {
+            std::string current = prefix;
+            collectWords(node, current, result);
+        }
+        return result;
+    }
+    
+#if DSA_STATS_ENABLED
+    // Node counting is part of the stats layer: the arena tries get these
+    // for free, this one would pay a counter update per node
+    size_t nodeCount() const { return nodes; }
+    
+    // Heap footprint of the nodes, ignoring allocator overhead
+    size_t memoryBytes() const { return nodes * sizeof(TrieNode); }
+#endif
+};
+
+// ==================== Compact Trie ====================
+// Same lowercase-word semantics as Trie, with nodes in one arena and 32-bit
+// indices. A node is 16 bytes: a 26-bit child bitmap plus the offset of a
+// contiguous child block, so child c sits at
+// block[popcount(mask & ((1 << c) - 1))]. Blocks that outgrow their size
+// are recycled through per-size free lists.
+class DoubleArrayTrie;
+
+class CompactTrie {
+private:
+    static const int ALPHABET_SIZE = 26;
+    
+    struct Node {
+        uint32_t childMask;
+        uint32_t children;  // Offset of the child block in childPool
+        int32_t prefixCount;
+        int32_t wordCount;
+    };
+    
+    std::vector<Node> nodes;  // nodes[0] is the root
+    std::vector<uint32_t> childPool;
+    std::vector<uint32_t> freeBlocks[ALPHABET_SIZE + 1];  // Indexed by block size
+    
+    static int letter(char c) {
+        unsigned index = (unsigned char)c - 'a';
+        return index < ALPHABET_SIZE ? (int)index : -1;
+    }
+    
+    uint32_t child(const Node& node, int c) const {
+        uint32_t bit = 1u << c;
+        if (!(node.childMask & bit)) return UINT32_MAX;
+        return childPool[node.children + __builtin_popcount(node.childMask & (bit - 1))];
+    }
+    
+    uint32_t allocateBlock(int size) {
+        if (!freeBlocks[size].empty()) {
+            uint32_t block = freeBlocks[size].back();
+            freeBlocks[size].pop_back();
+            return block;
+        }
+        uint32_t block = childPool.size();
+        childPool.resize(childPool.size() + size);
+        return block;
+    }
+    
+    uint32_t addChild(uint32_t parent, int c) {
+        uint32_t id = nodes.size();
+        nodes.push_back(Node{0, 0, 0, 0});
+        
+        Node& node = nodes[parent];
+        int oldSize = __builtin_popcount(node.childMask);
+        int rank = __builtin_popcount(node.childMask & ((1u << c) - 1));
+        uint32_t block = allocateBlock(oldSize + 1);
+        uint32_t* dst = childPool.data() + block;
+        const uint32_t* src = childPool.data() + node.children;
+        std::copy(src, src + rank, dst);
+        dst[rank] = id;
+        std::copy(src + rank, src + oldSize, dst + rank + 1);
+        
+        if (oldSize > 0) freeBlocks[oldSize].push_back(node.children);
+        node.children = block;
+        node.childMask |= 1u << c;
+        return id;
+    }
+    
+    // Path node, or UINT32_MAX when the prefix was never inserted or every
+    // word under it has been deleted
+    uint32_t searchNode(const std::string& word) const {
+        uint32_t current = 0;
+        for (char ch : word) {
+            int c = letter(ch);
+            if (c < 0) return UINT32_MAX;
+            current = child(nodes[current], c);
+            if (current == UINT32_MAX || nodes[current].prefixCount == 0) return UINT32_MAX;
+        }
+        return current;
+    }
+    
+    friend class DoubleArrayTrie;
+
+public:
+    CompactTrie() : nodes(1, Node{0, 0, 0, 0}) {}
+    
+    // Words must be lowercase a-z
+    void insert(const std::string& word) {
+        if (word.empty()) return;
+        
+        uint32_t current = 0;
+        for (char ch : word) {
+            int c = letter(ch);
+            uint32_t next = child(nodes[current], c);
+            if (next == UINT32_MAX) next = addChild(current, c);
+            current = next;
+            nodes[current].prefixCount++;
+        }
+        nodes[current].wordCount++;
+    }
+    
+    bool search(const std::string& word) const {
+        uint32_t node = searchNode(word);
+        return node != UINT32_MAX && nodes[node].wordCount > 0;
+    }
+    
+    bool startsWith(const std::string& prefix) const {
+        return searchNode(prefix) != UINT32_MAX;
+    }
+    
+    int countWordsWithPrefix(const std::string& prefix) const {
+        uint32_t node = searchNode(prefix);
+        return node != UINT32_MAX ? nodes[node].prefixCount : 0;
+    }
+    
+    int countExactWord(const std::string& word) const {
+        uint32_t node = searchNode(word);
+        return node != UINT32_MAX ? nodes[node].wordCount : 0;
+    }
+    
+    // Removes one occurrence. Emptied nodes stay in the arena with zero
+    // counts and are reused if the word comes back.
+    bool deleteWord(const std::string& word) {
+        if (!search(word)) return false;
+        uint32_t current = 0;
+        for (char ch : word) {
+            current = child(nodes[current], letter(ch));
+            nodes[current].prefixCount--;
+        }
+        nodes[current].wordCount--;
+        return true;
+    }
+    
+    size_t nodeCount() const { return nodes.size(); }
+    
+    size_t memoryBytes() const {
+        return nodes.capacity() * sizeof(Node) + childPool.capacity() * sizeof(uint32_t);
+    }
+};
+
+// ==================== Double-Array Trie ====================
+// Read-only dictionary frozen from a CompactTrie. The transition from state
+// s on letter code c (1..26) is t = base[s] + c, valid iff check[t] == s,
+// so each step is two array loads with no bitmap or pointer chasing.
+class DoubleArrayTrie {
+private:
+    static const int ALPHABET_SIZE = 26;
+    
+    std::vector<int32_t> base;
+    std::vector<int32_t> check;  // Parent state, -1 for a free slot
+    std::vector<int32_t> prefixCount;
+    std::vector<int32_t> wordCount;
+    
+    void ensureSize(size_t size) {
+        if (size <= check.size()) return;
+        size_t grown = std::max(size, check.size() * 2);
+        base.resize(grown, 0);
+        check.resize(grown, -1);
+        prefixCount.resize(grown, 0);
+        wordCount.resize(grown, 0);
+    }
+    
+    int32_t searchState(const std::string& word) const {
+        int32_t state = 0;
+        for (char ch : word) {
+            unsigned code = (unsigned char)ch - 'a' + 1;
+            if (code - 1 >= ALPHABET_SIZE) return -1;
+            size_t next = (size_t)base[state] + code;
+            if (next >= check.size() || check[next] != state || prefixCount[next] == 0) return -1;
+            state = next;
+        }
+        return state;
+    }
+
+public:
+    explicit DoubleArrayTrie(const CompactTrie& trie) {
+        ensureSize(ALPHABET_SIZE + 1);
+        check[0] = 0;
+        
+        // BFS over (trie node, state); each state gets the lowest base whose
+        // child slots are all free
+        std::vector<std::pair<uint32_t, int32_t>> queue = {{0, 0}};
+        size_t firstFree = 1;
+        for (size_t head = 0; head < queue.size(); head++) {
+            auto [nodeId, state] = queue[head];
+            const CompactTrie::Node& node = trie.nodes[nodeId];
+            if (node.childMask == 0) continue;
+            
+            while (firstFree < check.size() && check[firstFree] != -1) firstFree++;
+            int firstCode = __builtin_ctz(node.childMask) + 1;
+            size_t b = firstFree > (size_t)firstCode ? firstFree - firstCode : 0;
+            for (;; b++) {
+                ensureSize(b + ALPHABET_SIZE + 1);
+                bool fits = true;
+                for (uint32_t mask = node.childMask; mask && fits; mask &= mask - 1) {
+                    fits = check[b + __builtin_ctz(mask) + 1] == -1;
+                }
+                if (fits) break;
+            }
+            
+            base[state] = b;
+            int rank = 0;
+            for (uint32_t mask = node.childMask; mask; mask &= mask - 1, rank++) {
+                int32_t next = b + __builtin_ctz(mask) + 1;
+                uint32_t childId = trie.childPool[node.children + rank];
+                check[next] = state;
+                prefixCount[next] = trie.nodes[childId].prefixCount;
+                wordCount[next] = trie.nodes[childId].wordCount;
+                queue.push_back({childId, next});
+            }
+        }
+    }
+    
+    bool search(const std::string& word) const {
+        int32_t state = searchState(word);
+        return state >= 0 && wordCount[state] > 0;
+    }
+    
+    bool startsWith(const std::string& prefix) const {
+        return searchState(prefix) >= 0;
+    }
+    
+    int countWordsWithPrefix(const std::string& prefix) const {
+        int32_t state = searchState(prefix);
+        return state >= 0 ? prefixCount[state] : 0;
+    }
+    
+    int countExactWord(const std::string& word) const {
+        int32_t state = searchState(word);
+        return state >= 0 ? wordCount[state] : 0;
+    }
+    
+    size_t memoryBytes() const {
+        return 4 * check.capacity() * sizeof(int32_t);
+    }
+};
+
+// ==================== Radix (Patricia) Trie ====================
+// Byte-keyed trie for arbitrary strings (URLs, UTF-8 names). Single-child
+// chains collapse into one edge whose label is a slice of a shared buffer,
+// so splitting an edge never copies bytes. Children form a sibling list
+// sorted by first byte, keeping nodes at 24 bytes for any alphabet.
+class RadixTrie {
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    
+    struct Node {
+        uint32_t labelOffset;
+        uint32_t labelLength;
+        uint32_t firstChild;
+        uint32_t nextSibling;
+        int32_t prefixCount;
+        int32_t wordCount;
+    };
+    
+    std::vector<Node> nodes;  // nodes[0] is the root, with an empty label
+    std::string labels;
+    
+    std::string_view label(const Node& node) const {
+        return std::string_view(labels).substr(node.labelOffset, node.labelLength);
+    }
+    
+    unsigned char firstByte(uint32_t id) const {
+        return labels[nodes[id].labelOffset];
+    }
+    
+    uint32_t findChild(uint32_t parent, unsigned char byte) const {
+        for (uint32_t c = nodes[parent].firstChild; c != NONE; c = nodes[c].nextSibling) {
+            unsigned char first = firstByte(c);
+            if (first == byte) return c;
+            if (first > byte) break;
+        }
+        return NONE;
+    }
+    
+    void linkChild(uint32_t parent, uint32_t child) {
+        unsigned char byte = firstByte(child);
+        uint32_t* link = &nodes[parent].firstChild;
+        while (*link != NONE && firstByte(*link) < byte) link = &nodes[*link].nextSibling;
+        nodes[child].nextSibling = *link;
+        *link = child;
+    }
+    
+    // Finds where key ends: the node whose edge contains the last byte and
+    // how much of that edge was consumed. NONE if the key leaves the trie.
+    std::pair<uint32_t, uint32_t> locate(std::string_view key) const {
+        uint32_t current = 0;
+        uint32_t consumed = 0;
+        while (!key.empty()) {
+            current = findChild(current, key[0]);
+            if (current == NONE || nodes[current].prefixCount == 0) return {NONE, 0};
+            std::string_view edge = label(nodes[current]);
+            consumed = std::min(edge.size(), key.size());
+            if (edge.compare(0, consumed, key, 0, consumed) != 0) return {NONE, 0};
+            key.remove_prefix(consumed);
+        }
+        return {current, consumed};
+    }
+    
+    void collectWords(uint32_t id, std::string& prefix, std::vector<std::string>& result) const {
+        const Node& node = nodes[id];
+        if (node.wordCount > 0) result.push_back(prefix);
+        for (uint32_t c = node.firstChild; c != NONE; c = nodes[c].nextSibling) {
+            if (nodes[c].prefixCount == 0) continue;
+            std::string_view edge = label(nodes[c]);
+            prefix.append(edge);
+            collectWords(c, prefix, result);
+            prefix.resize(prefix.size() - edge.size());
+        }
+    }
+
+public:
+    RadixTrie() : nodes(1, Node{0, 0, NONE, NONE, 0, 0}) {}
+    
+    void insert(std::string_view word) {
+        if (word.empty()) return;
+        
+        uint32_t current = 0;
+        while (!word.empty()) {
+            uint32_t next = findChild(current, word[0]);
+            if (next == NONE) {
+                next = nodes.size();
+                nodes.push_back(Node{(uint32_t)labels.size(), (uint32_t)word.size(), NONE, NONE, 1, 1});
+                labels.append(word);
+                linkChild(current, next);
+                return;
+            }
+            
+            std::string_view edge = label(nodes[next]);
+            uint32_t common = 0;
+            while (common < edge.size() && common < word.size() && edge[common] == word[common]) {
+                common++;
+            }
+            if (common < edge.size()) {
+                // Split: `next` keeps the shared head, a new node takes the tail
+                uint32_t tail = nodes.size();
+                Node split = nodes[next];
+                split.labelOffset += common;
+                split.labelLength -= common;
+                split.nextSibling = NONE;
+                nodes.push_back(split);
+                
+                Node& head = nodes[next];
+                head.labelLength = common;
+                head.firstChild = tail;
+                head.wordCount = 0;
+            }
+            
+            nodes[next].prefixCount++;
+            word.remove_prefix(common);
+            current = next;
+        }
+        nodes[current].wordCount++;
+    }
+    
+    bool search(std::string_view word) const {
+        return countExactWord(word) > 0;
+    }
+    
+    bool startsWith(std::string_view prefix) const {
+        return locate(prefix).first != NONE;
+    }
+    
+    int countWordsWithPrefix(std::string_view prefix) const {
+        uint32_t node = locate(prefix).first;
+        return node != NONE ? nodes[node].prefixCount : 0;
+    }
+    
+    int countExactWord(std::string_view word) const {
+        auto [node, consumed] = locate(word);
+        if (node == NONE || consumed != nodes[node].labelLength) return 0;
+        return nodes[node].wordCount;
+    }
+    
+    // Removes one occurrence; emptied edges stay with zero counts
+    bool deleteWord(std::string_view word) {
+        if (!search(word)) return false;
+        uint32_t current = 0;
+        while (!word.empty()) {
+            current = findChild(current, word[0]);
+            nodes[current].prefixCount--;
+            word.remove_prefix(nodes[current].labelLength);
+        }
+        nodes[current].wordCount--;
+        return true;
+    }
+    
+    std::vector<std::string> getWordsWithPrefix(std::string_view prefix) const {
+        std::vector<std::string> result;
+        auto [node, consumed] = locate(prefix);
+        if (node != NONE) {
+            std::string current(prefix);
+            current.append(label(nodes[node]).substr(consumed));
+            collectWords(node, current, result);
+        }
+        return result;
+    }
+    
+    size_t nodeCount() const { return nodes.size(); }
+    
+    size_t memoryBytes() const {
+        return nodes.capacity() * sizeof(Node) + labels.capacity();
+    }
+};
+
+// ==================== Top-K Autocomplete Trie ====================
+// Every node caches the ids of the K heaviest words in its subtree, so
+// topK(prefix) is a walk down the prefix plus a copy of at most K entries,
+// independent of how many words share the prefix. Raising a weight updates
+// each cached list on the path in place; lowering one rebuilds the path
+// bottom-up by merging the children's lists, which are exact.
+class AutocompleteTrie {
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    
+    struct Node {
+        uint32_t firstChild;
+        uint32_t nextSibling;
+        int32_t wordId;  // -1 if no word ends here
+        uint8_t byte;
+        uint8_t topSize;
+    };
+    
+    int K;
+    std::vector<Node> nodes;        // nodes[0] is the root
+    std::vector<uint32_t> topPool;  // K slots per node, heaviest first
+    std::deque<std::string> words;  // Stable storage behind returned views
+    std::vector<long long> weights;
+    
+    bool heavier(uint32_t a, uint32_t b) const {
+        if (weights[a] != weights[b]) return weights[a] > weights[b];
+        return words[a] < words[b];
+    }
+    
+    uint32_t findChild(uint32_t parent, unsigned char byte) const {
+        for (uint32_t c = nodes[parent].firstChild; c != NONE; c = nodes[c].nextSibling) {
+            if (nodes[c].byte == byte) return c;
+            if (nodes[c].byte > byte) break;
+        }
+        return NONE;
+    }
+    
+    uint32_t addChild(uint32_t parent, unsigned char byte) {
+        uint32_t id = nodes.size();
+        nodes.push_back(Node{NONE, NONE, -1, byte, 0});
+        topPool.resize(topPool.size() + K);
+        
+        uint32_t* link = &nodes[parent].firstChild;
+        while (*link != NONE && nodes[*link].byte < byte) link = &nodes[*link].nextSibling;
+        nodes[id].nextSibling = *link;
+        *link = id;
+        return id;
+    }
+    
+    // Word `id` got heavier (or is new): move it up in the node's list
+    void promote(uint32_t node, uint32_t id) {
+        uint32_t* top = topPool.data() + (size_t)node * K;
+        int size = nodes[node].topSize;
+        int pos = std::find(top, top + size, id) - top;
+        if (pos == size) {
+            if (size < K) nodes[node].topSize = ++size;
+            else if (!heavier(id, top[K - 1])) return;
+            pos = size - 1;
+        }
+        while (pos > 0 && heavier(id, top[pos - 1])) {
+            top[pos] = top[pos - 1];
+            pos--;
+        }
+        top[pos] = id;
+    }
+    
+    void rebuild(uint32_t node) {
+        std::vector<uint32_t> candidates;
+        if (nodes[node].wordId >= 0) candidates.push_back(nodes[node].wordId);
+        for (uint32_t c = nodes[node].firstChild; c != NONE; c = nodes[c].nextSibling) {
+            const uint32_t* top = topPool.data() + (size_t)c * K;
+            candidates.insert(candidates.end(), top, top + nodes[c].topSize);
+        }
+        int size = std::min<int>(K, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + size, candidates.end(),
+                          [this](uint32_t a, uint32_t b) { return heavier(a, b); });
+        std::copy(candidates.begin(), candidates.begin() + size, topPool.begin() + (size_t)node * K);
+        nodes[node].topSize = size;
+    }
+
+public:
+    explicit AutocompleteTrie(int k = 10)
+        : K(std::min(std::max(k, 1), 255)), nodes(1, Node{NONE, NONE, -1, 0, 0}), topPool(K) {}
+    
+    // Adds word with the given weight, or replaces the weight of an existing word
+    void insert(std::string_view word, long long weight) {
+        if (word.empty()) return;
+        
+        std::vector<uint32_t> path = {0};
+        for (unsigned char byte : word) {
+            uint32_t next = findChild(path.back(), byte);
+            if (next == NONE) next = addChild(path.back(), byte);
+            path.push_back(next);
+        }
+        
+        Node& leaf = nodes[path.back()];
+        bool lighter = false;
+        if (leaf.wordId < 0) {
+            leaf.wordId = words.size();
+            words.emplace_back(word);
+            weights.push_back(weight);
+        } else {
+            lighter = weight < weights[leaf.wordId];
+            weights[leaf.wordId] = weight;
+        }
+        
+        uint32_t id = nodes[path.back()].wordId;
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            if (lighter) rebuild(*it);
+            else promote(*it, id);
+        }
+    }
+    
+    // Up to k (at most the constructor's K) words under prefix, heaviest
+    // first, ties in byte order. Views stay valid for the trie's lifetime.
+    std::vector<std::pair<std::string_view, long long>> topK(std::string_view prefix, int k) const {
+        std::vector<std::pair<std::string_view, long long>> result;
+        uint32_t node = 0;
+        for (unsigned char byte : prefix) {
+            node = findChild(node, byte);
+            if (node == NONE) return result;
+        }
+        
+        int count = std::min<int>(k, nodes[node].topSize);
+        const uint32_t* top = topPool.data() + (size_t)node * K;
+        for (int i = 0; i < count; i++) {
+            result.emplace_back(words[top[i]], weights[top[i]]);
+        }
+        return result;
+    }
+    
+    size_t wordCount() const { return words.size(); }
+};
+
+// ==================== XOR Trie for Maximum XOR Problems ====================
+class XORTrie {
+private:
+    static const int MAX_BITS = 31;
+    
+    struct TrieNode {
+        std::unique_ptr<TrieNode> children[2];
+        int count;
+        
+        TrieNode() : count(0) {
+            children[0] = nullptr;
+            children[1] = nullptr;
+        }
+    };
+    
+    std::unique_ptr<TrieNode> root;
+    DSA_STAT(size_t nodes = 1;)  // remove() only decrements counts, so this never shrinks
+
+public:
+    XORTrie() : root(std::make_unique<TrieNode>()) {}
+    
+    void insert(int num) {
+        TrieNode* current = root.get();
+        for (int i = MAX_BITS; i >= 0; i--) {
+            int bit = (num >> i) & 1;
+            if (!current->children[bit]) {
+                current->children[bit] = std::make_unique<TrieNode>();
+                DSA_STAT(nodes++;)
+            }
+            current = current->children[bit].get();
+            current->count++;
+        }
+    }
+    
+    void remove(int num) {
+        TrieNode* current = root.get();
+        for (int i = MAX_BITS; i >= 0; i--) {
+            int bit = (num >> i) & 1;
+            if (current->children[bit]) {
+                current = current->children[bit].get();
+                current->count--;
+            }
+        }
+    }
+    
+    // Find maximum XOR with given number
+    int getMaxXOR(int num) {
+        TrieNode* current = root.get();
+        int maxXor = 0;
+        
+        for (int i = MAX_BITS; i >= 0; i--) {
+            int bit = (num >> i) & 1;
+            int oppositeBit = 1 - bit;
+            
+            // Try to go opposite direction for max XOR
+            if (current->children[oppositeBit] && current->children[oppositeBit]->count > 0) {
+                maxXor |= (1 << i);
+                current = current->children[oppositeBit].get();
+            } else if (current->children[bit] && current->children[bit]->count > 0) {
+                current = current->children[bit].get();
+            } else {
+                break;
+            }
+        }
+        return maxXor;
+    }
+    
+#if DSA_STATS_ENABLED
+    size_t nodeCount() const { return nodes; }
+    size_t memoryBytes() const { return nodes * sizeof(TrieNode); }
+#endif
+};
+
+// ==================== Flat XOR Trie ====================
+// XOR trie over unsigned keys (uint32_t or uint64_t) with all nodes in one
+// array and 32-bit child indices; index 0 is the root, so 0 also means
+// "no child". Every attached node has a positive count, so remove() detaches
+// the first node whose count drops to zero and recycles that chain through
+// a free list, and queries only test for a child instead of its count.
+template<typename Key = uint32_t>
+class FlatXORTrie {
+    static_assert(std::is_unsigned<Key>::value, "FlatXORTrie needs an unsigned key type");
+
+private:
+    static constexpr int BITS = sizeof(Key) * 8;
+    
+    struct Node {
+        uint32_t child[2];
+        int32_t count;
+    };
+    
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeList;
+    
+    static int bitOf(Key key, int i) { return (key >> i) & 1; }
+    
+    uint32_t allocate() {
+        if (!freeList.empty()) {
+            uint32_t id = freeList.back();
+            freeList.pop_back();
+            nodes[id] = Node{{0, 0}, 0};
+            return id;
+        }
+        nodes.push_back(Node{{0, 0}, 0});
+        return nodes.size() - 1;
+    }
+    
+    // Preorder over sorted[lo, hi) sharing all bits above `bit`, so each
+    // subtree occupies a contiguous run of the array
+    void buildRange(uint32_t node, const std::vector<Key>& sorted, size_t lo, size_t hi, int bit) {
+        nodes[node].count = hi - lo;
+        if (bit < 0) return;
+        size_t split = std::partition_point(sorted.begin() + lo, sorted.begin() + hi,
+                                            [&](Key k) { return bitOf(k, bit) == 0; }) - sorted.begin();
+        if (split > lo) {
+            uint32_t left = allocate();
+            nodes[node].child[0] = left;
+            buildRange(left, sorted, lo, split, bit - 1);
+        }
+        if (hi > split) {
+            uint32_t right = allocate();
+            nodes[node].child[1] = right;
+            buildRange(right, sorted, split, hi, bit - 1);
+        }
+    }
+
+public:
+    FlatXORTrie() : nodes(1, Node{{0, 0}, 0}) {}
+    
+    // Bulk build from keys sorted ascending (duplicates allowed)
+    explicit FlatXORTrie(const std::vector<Key>& sorted) : nodes(1, Node{{0, 0}, 0}) {
+        nodes.reserve(2 * sorted.size() + BITS);
+        if (!sorted.empty()) buildRange(0, sorted, 0, sorted.size(), BITS - 1);
+    }
+    
+    void insert(Key key) {
+        uint32_t current = 0;
+        nodes[0].count++;
+        for (int i = BITS - 1; i >= 0; i--) {
+            int bit = bitOf(key, i);
+            if (!nodes[current].child[bit]) {
+                uint32_t created = allocate();
+                nodes[current].child[bit] = created;
+            }
+            current = nodes[current].child[bit];
+            nodes[current].count++;
+        }
+    }
+    
+    bool contains(Key key) const {
+        uint32_t current = 0;
+        for (int i = BITS - 1; i >= 0; i--) {
+            current = nodes[current].child[bitOf(key, i)];
+            if (!current) return false;
+        }
+        return true;
+    }
+    
+    // Removes one occurrence; returns false if key is absent
+    bool remove(Key key) {
+        if (!contains(key)) return false;
+        uint32_t current = 0;
+        nodes[0].count--;
+        for (int i = BITS - 1; i >= 0; i--) {
+            uint32_t& link = nodes[current].child[bitOf(key, i)];
+            uint32_t next = link;
+            if (--nodes[next].count == 0) {
+                // The rest of the path carried only this key
+                link = 0;
+                for (int j = i - 1; ; j--) {
+                    freeList.push_back(next);
+                    if (j < 0) break;
+                    next = nodes[next].child[bitOf(key, j)];
+                }
+                return true;
+            }
+            current = next;
+        }
+        return true;
+    }
+    
+    // Maximum key ^ q over stored keys, 0 if empty
+    Key getMaxXOR(Key q) const {
+        if (nodes[0].count == 0) return 0;
+        uint32_t current = 0;
+        Key maxXor = 0;
+        for (int i = BITS - 1; i >= 0; i--) {
+            int want = bitOf(q, i) ^ 1;
+            uint32_t next = nodes[current].child[want];
+            if (next) {
+                maxXor |= Key(1) << i;
+                current = next;
+            } else {
+                current = nodes[current].child[want ^ 1];
+            }
+        }
+        return maxXor;
+    }
+    
+    // Batched queries walked level by level: every query advances one bit
+    // per pass and prefetches its next node, so the independent lookups
+    // overlap their cache misses instead of each chasing a full path alone
+    std::vector<Key> getMaxXOR(const std::vector<Key>& queries) const {
+        std::vector<Key> result(queries.size(), 0);
+        if (nodes[0].count == 0) return result;
+        std::vector<uint32_t> cursor(queries.size(), 0);
+        for (int i = BITS - 1; i >= 0; i--) {
+            for (size_t q = 0; q < queries.size(); q++) {
+                const Node& node = nodes[cursor[q]];
+                int want = bitOf(queries[q], i) ^ 1;
+                uint32_t next = node.child[want];
+                result[q] |= Key(next != 0) << i;
+                cursor[q] = next ? next : node.child[want ^ 1];
+                __builtin_prefetch(&nodes[cursor[q]]);
+            }
+        }
+        return result;
+    }
+    
+    int size() const { return nodes[0].count; }
+    size_t nodeCount() const { return nodes.size() - freeList.size(); }
+    size_t memoryBytes() const {
+        return nodes.capacity() * sizeof(Node) + freeList.capacity() * sizeof(uint32_t);
+    }
+};
+
+#endif  // DSA_TRIE_H
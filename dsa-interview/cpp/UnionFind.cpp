@@ -10,108 +10,8 @@
 
 #include <iostream>
 #include <vector>
-#include <numeric>
 
-class UnionFind {
-private:
-    std::vector<int> parent;
-    std::vector<int> rank_;
-    std::vector<int> size_;
-    int components;
-
-public:
-    UnionFind(int n) : parent(n), rank_(n, 0), size_(n, 1), components(n) {
-        std::iota(parent.begin(), parent.end(), 0); // parent[i] = i
-    }
-    
-    // Find with path compression
-    int find(int x) {
-        if (parent[x] != x) {
-            parent[x] = find(parent[x]); // Path compression
-        }
-        return parent[x];
-    }
-    
-    // Union by rank, returns true if union was performed
-    bool unite(int x, int y) {
-        int rootX = find(x);
-        int rootY = find(y);
-        
-        if (rootX == rootY) return false;
-        
-        if (rank_[rootX] < rank_[rootY]) {
-            parent[rootX] = rootY;
-            size_[rootY] += size_[rootX];
-        } else if (rank_[rootX] > rank_[rootY]) {
-            parent[rootY] = rootX;
-            size_[rootX] += size_[rootY];
-        } else {
-            parent[rootY] = rootX;
-            rank_[rootX]++;
-            size_[rootX] += size_[rootY];
-        }
-        
-        components--;
-        return true;
-    }
-    
-    bool connected(int x, int y) {
-        return find(x) == find(y);
-    }
-    
-    int getComponents() const {
-        return components;
-    }
-    
-    int getComponentSize(int x) {
-        return size_[find(x)];
-    }
-};
-
-// ==================== Weighted Union-Find ====================
-// Useful for problems like "Evaluate Division" (Leetcode 399)
-class WeightedUnionFind {
-private:
-    std::vector<int> parent;
-    std::vector<double> weight; // weight[i] = value of i / value of parent[i]
-
-public:
-    WeightedUnionFind(int n) : parent(n), weight(n, 1.0) {
-        std::iota(parent.begin(), parent.end(), 0);
-    }
-    
-    // Returns pair<root, weight_to_root>
-    std::pair<int, double> find(int x) {
-        if (parent[x] != x) {
-            auto [root, w] = find(parent[x]);
-            parent[x] = root;
-            weight[x] *= w;
-        }
-        return {parent[x], weight[x]};
-    }
-    
-    // Union x and y with x/y = value
-    void unite(int x, int y, double value) {
-        auto [rootX, weightX] = find(x);
-        auto [rootY, weightY] = find(y);
-        
-        if (rootX == rootY) return;
-        
-        parent[rootX] = rootY;
-        // x/rootX = weightX, y/rootY = weightY
-        // x/y = value => rootX/rootY = value * weightY / weightX
-        weight[rootX] = value * weightY / weightX;
-    }
-    
-    // Get x/y, returns -1.0 if not computable
-    double query(int x, int y) {
-        auto [rootX, weightX] = find(x);
-        auto [rootY, weightY] = find(y);
-        
-        if (rootX != rootY) return -1.0;
-        return weightX / weightY;
-    }
-};
+#include "UnionFind.h"
 
 int main() {
     UnionFind uf(10);
@@ -132,6 +32,21 @@ int main() {
     std::cout << "0 and 4 connected: " << (uf.connected(0, 4) ? "true" : "false") << std::endl;
     std::cout << "Component size of 0: " << uf.getComponentSize(0) << std::endl;
     
+    // Concurrent unions from every pool thread
+    std::cout << "\n--- Parallel Connected Components ---" << std::endl;
+    ThreadPool pool(4);
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i + 2 < 1000; i++) edges.push_back({i, i + 2});  // Evens and odds
+    edges.push_back({1000, 1001});
+    Components cc = connectedComponents(1003, edges, pool);
+    std::cout << "Components: " << cc.count << std::endl;  // 4: evens, odds, {1000, 1001}, {1002}
+    std::cout << "Labels of 0, 1, 998, 1001: " << cc.label[0] << " " << cc.label[1] << " "
+              << cc.label[998] << " " << cc.label[1001] << std::endl;  // 0 1 0 2
+    
+    ConcurrentUnionFind shared(8);
+    pool.parallelFor(7, 1, [&](size_t lo, size_t, unsigned) { shared.unite(lo, lo + 1); });
+    std::cout << "Concurrent unite components: " << shared.getComponents() << std::endl;  // 1
+    
     // Weighted Union-Find demo (Evaluate Division style)
     std::cout << "\n--- Weighted Union-Find Demo ---" << std::endl;
     WeightedUnionFind wuf(4);
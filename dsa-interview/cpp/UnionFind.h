@@ -0,0 +1,266 @@
+/**
+ * Union-Find (Disjoint Set Union) Implementations in C++
+ * 
+ * Time Complexity (with path compression + union by rank):
+ * - Find: O(α(n)) ≈ O(1) amortized
+ * - Union: O(α(n)) ≈ O(1) amortized
+ * 
+ * Space Complexity: O(n)
+ * 
+ * Shared by UnionFind.cpp, Graph.h (Kruskal, Borůvka) and the bench/ suite.
+ */
+
+#ifndef DSA_UNION_FIND_H
+#define DSA_UNION_FIND_H
+
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+#include "ThreadPool.h"
+
+// ==================== Union-Find ====================
+// parent, rank and size share one 12-byte entry, so a find step touches a
+// single cache line. find is iterative (path halving) and cannot overflow
+// the stack on long chains.
+class UnionFind {
+private:
+    struct Entry {
+        int parent;
+        int rank;
+        int size;
+    };
+    
+    std::vector<Entry> entries;
+    int components;
+
+public:
+    UnionFind(int n) : entries(n), components(n) {
+        for (int i = 0; i < n; i++) entries[i] = Entry{i, 0, 1};
+    }
+    
+    // Find with path halving: every visited node skips to its grandparent
+    int find(int x) {
+        while (entries[x].parent != x) {
+            int& parent = entries[x].parent;
+            parent = entries[parent].parent;
+            x = parent;
+        }
+        return x;
+    }
+    
+    // Union by rank, returns true if union was performed
+    bool unite(int x, int y) {
+        int rootX = find(x);
+        int rootY = find(y);
+        
+        if (rootX == rootY) return false;
+        
+        if (entries[rootX].rank < entries[rootY].rank) std::swap(rootX, rootY);
+        entries[rootY].parent = rootX;
+        entries[rootX].size += entries[rootY].size;
+        if (entries[rootX].rank == entries[rootY].rank) entries[rootX].rank++;
+        
+        components--;
+        return true;
+    }
+    
+    bool connected(int x, int y) {
+        return find(x) == find(y);
+    }
+    
+    int getComponents() const {
+        return components;
+    }
+    
+    int getComponentSize(int x) {
+        return entries[find(x)].size;
+    }
+};
+
+// ==================== Concurrent Union-Find ====================
+// Wait-free find / lock-free unite for many threads, after Anderson & Woll:
+// each element is one 64-bit word holding (rank << 32 | parent). A root is
+// linked by CAS on its whole word, so a concurrent rank bump or link makes
+// the CAS fail and the unite retries from fresh roots. Roots are ordered by
+// (rank, index), which only grows, so links can never form a cycle. find
+// halves paths with CAS and simply ignores a lost race.
+// Component sizes are not tracked concurrently; ask for them once writers
+// are done (see connectedComponents).
+class ConcurrentUnionFind {
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> words;
+    int n;
+    std::atomic<int> components;
+    
+    static uint64_t pack(uint32_t rank, uint32_t parent) { return (uint64_t)rank << 32 | parent; }
+    static uint32_t parentOf(uint64_t word) { return (uint32_t)word; }
+    static uint32_t rankOf(uint64_t word) { return word >> 32; }
+
+public:
+    ConcurrentUnionFind(int n) : words(new std::atomic<uint64_t>[n]), n(n), components(n) {
+        for (int i = 0; i < n; i++) words[i].store(pack(0, i), std::memory_order_relaxed);
+    }
+    
+    int size() const { return n; }
+    
+    int find(int x) {
+        while (true) {
+            uint64_t word = words[x].load(std::memory_order_acquire);
+            int parent = parentOf(word);
+            if (parent == x) return x;
+            
+            int grandparent = parentOf(words[parent].load(std::memory_order_acquire));
+            if (grandparent == parent) return parent;
+            words[x].compare_exchange_weak(word, pack(rankOf(word), grandparent),
+                                           std::memory_order_release, std::memory_order_relaxed);
+            x = grandparent;
+        }
+    }
+    
+    bool unite(int x, int y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) return false;
+            
+            uint64_t wordX = words[x].load(std::memory_order_acquire);
+            uint64_t wordY = words[y].load(std::memory_order_acquire);
+            if (parentOf(wordX) != (uint32_t)x || parentOf(wordY) != (uint32_t)y) continue;
+            
+            // Link the smaller (rank, index) root under the larger one
+            if (rankOf(wordX) > rankOf(wordY) || (rankOf(wordX) == rankOf(wordY) && x > y)) {
+                std::swap(x, y);
+                std::swap(wordX, wordY);
+            }
+            if (!words[x].compare_exchange_strong(wordX, pack(rankOf(wordX), y),
+                                                  std::memory_order_acq_rel)) {
+                continue;
+            }
+            if (rankOf(wordX) == rankOf(wordY)) {
+                // Best effort: losing this race only leaves the rank low
+                words[y].compare_exchange_strong(wordY, pack(rankOf(wordY) + 1, y),
+                                                 std::memory_order_acq_rel);
+            }
+            components.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    
+    bool connected(int x, int y) {
+        // Roots can move while we look, so retry until x's root is stable
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) return true;
+            if (parentOf(words[x].load(std::memory_order_acquire)) == (uint32_t)x) return false;
+        }
+    }
+    
+    int getComponents() const {
+        return components.load(std::memory_order_relaxed);
+    }
+};
+
+// ==================== Parallel Connected Components ====================
+struct Components {
+    int count;
+    std::vector<int> label;  // Dense ids in [0, count), ordered by smallest vertex
+};
+
+namespace detail {
+
+inline Components labelComponents(ConcurrentUnionFind& uf, ThreadPool& pool) {
+    const int n = uf.size();
+    Components result{0, std::vector<int>(n)};
+    pool.parallelFor(n, 1 << 14, [&](size_t lo, size_t hi, unsigned) {
+        for (size_t v = lo; v < hi; v++) result.label[v] = uf.find(v);
+    });
+    
+    std::vector<int> dense(n, -1);
+    for (int v = 0; v < n; v++) {
+        if (dense[result.label[v]] < 0) dense[result.label[v]] = result.count++;
+    }
+    pool.parallelFor(n, 1 << 14, [&](size_t lo, size_t hi, unsigned) {
+        for (size_t v = lo; v < hi; v++) result.label[v] = dense[result.label[v]];
+    });
+    return result;
+}
+
+}  // namespace detail
+
+// Edge list version: edges are united from every pool thread at once
+inline Components connectedComponents(int n, const std::vector<std::pair<int, int>>& edges,
+                                      ThreadPool& pool) {
+    ConcurrentUnionFind uf(n);
+    pool.parallelFor(edges.size(), 1 << 12, [&](size_t lo, size_t hi, unsigned) {
+        for (size_t i = lo; i < hi; i++) uf.unite(edges[i].first, edges[i].second);
+    });
+    return detail::labelComponents(uf, pool);
+}
+
+// Graph version: any graph with vertexCount() and neighbors(u) yielding
+// (v, weight) pairs, e.g. Graph and CsrGraph in Graph.h
+template<typename G>
+Components connectedComponents(const G& graph, ThreadPool& pool) {
+    ConcurrentUnionFind uf(graph.vertexCount());
+    pool.parallelFor(graph.vertexCount(), 256, [&](size_t lo, size_t hi, unsigned) {
+        for (size_t u = lo; u < hi; u++) {
+            for (auto [v, weight] : graph.neighbors(u)) {
+                (void)weight;
+                uf.unite(u, v);
+            }
+        }
+    });
+    return detail::labelComponents(uf, pool);
+}
+
+// ==================== Weighted Union-Find ====================
+// Useful for problems like "Evaluate Division" (Leetcode 399)
+class WeightedUnionFind {
+private:
+    std::vector<int> parent;
+    std::vector<double> weight; // weight[i] = value of i / value of parent[i]
+
+public:
+    WeightedUnionFind(int n) : parent(n), weight(n, 1.0) {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+    
+    // Returns pair<root, weight_to_root>
+    std::pair<int, double> find(int x) {
+        if (parent[x] != x) {
+            auto [root, w] = find(parent[x]);
+            parent[x] = root;
+            weight[x] *= w;
+        }
+        return {parent[x], weight[x]};
+    }
+    
+    // Union x and y with x/y = value
+    void unite(int x, int y, double value) {
+        auto [rootX, weightX] = find(x);
+        auto [rootY, weightY] = find(y);
+        
+        if (rootX == rootY) return;
+        
+        parent[rootX] = rootY;
+        // x/rootX = weightX, y/rootY = weightY
+        // x/y = value => rootX/rootY = value * weightY / weightX
+        weight[rootX] = value * weightY / weightX;
+    }
+    
+    // Get x/y, returns -1.0 if not computable
+    double query(int x, int y) {
+        auto [rootX, weightX] = find(x);
+        auto [rootY, weightY] = find(y);
+        
+        if (rootX != rootY) return -1.0;
+        return weightX / weightY;
+    }
+};
+
+#endif  // DSA_UNION_FIND_H
@@ -0,0 +1,170 @@
+/**
+ * Benchmark Input Generators
+ *
+ * Deterministic (seeded) inputs shared by the bench_*.cpp executables:
+ * - Keys: uniform or Zipfian over [0, universe)
+ * - Graphs: road-like grids (low degree, large diameter) and R-MAT social
+ *   graphs (power-law degree, small diameter)
+ * - Words: random lowercase strings for the tries
+ *
+ * Benchmarks take the distribution as their second argument so the JSON
+ * output names it, e.g. BM_LRUCache/65536/1 is 64Ki keys, Zipfian.
+ */
+
+#ifndef DSA_BENCH_INPUTS_H
+#define DSA_BENCH_INPUTS_H
+
+#include <vector>
+#include <string>
+#include <tuple>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+
+namespace bench {
+
+enum Distribution { UNIFORM = 0, ZIPF = 1 };
+
+inline const char* distributionName(int d) { return d == ZIPF ? "zipf" : "uniform"; }
+
+// Inverse-CDF sampler for P(k) ~ 1 / (k + 1)^skew over [0, universe).
+// Rank 0 is the hottest key; ranks are scattered by a fixed permutation so
+// hot keys don't share hash buckets or cache lines by construction.
+class ZipfGenerator {
+private:
+    std::vector<double> cdf;
+    std::vector<int> permutation;
+    std::uniform_real_distribution<double> unit;
+
+public:
+    ZipfGenerator(int universe, double skew = 0.99, uint64_t seed = 1)
+        : cdf(universe), permutation(universe), unit(0.0, 1.0) {
+        double total = 0;
+        for (int k = 0; k < universe; k++) {
+            total += 1.0 / std::pow(k + 1.0, skew);
+            cdf[k] = total;
+        }
+        for (double& c : cdf) c /= total;
+        for (int k = 0; k < universe; k++) permutation[k] = k;
+        std::shuffle(permutation.begin(), permutation.end(), std::mt19937_64(seed ^ 0x9e3779b97f4a7c15ULL));
+    }
+
+    template<typename Rng>
+    int operator()(Rng& rng) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), unit(rng)) - cdf.begin();
+        return permutation[std::min(rank, cdf.size() - 1)];
+    }
+};
+
+inline std::vector<int> keys(size_t count, int universe, int distribution, uint64_t seed = 1) {
+    std::mt19937_64 rng(seed);
+    std::vector<int> out(count);
+    if (distribution == ZIPF) {
+        ZipfGenerator zipf(universe, 0.99, seed);
+        for (int& k : out) k = zipf(rng);
+    } else {
+        std::uniform_int_distribution<int> pick(0, universe - 1);
+        for (int& k : out) k = pick(rng);
+    }
+    return out;
+}
+
+// Inclusive [l, r] ranges; Zipfian picks favour short ranges (l near r)
+inline std::vector<std::pair<int, int>> ranges(size_t count, int n, int distribution, uint64_t seed = 2) {
+    std::vector<int> length = keys(count, n, distribution, seed);
+    std::mt19937_64 rng(seed + 1);
+    std::vector<std::pair<int, int>> out(count);
+    for (size_t i = 0; i < count; i++) {
+        int len = distribution == ZIPF ? std::min(length[i] % 64, n - 1) : length[i];
+        int l = std::uniform_int_distribution<int>(0, n - 1 - len)(rng);
+        out[i] = {l, l + len};
+    }
+    return out;
+}
+
+inline std::vector<std::string> words(size_t count, uint64_t seed = 3, int minLength = 3, int maxLength = 12) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> length(minLength, maxLength);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::vector<std::string> out(count);
+    for (std::string& w : out) {
+        w.resize(length(rng));
+        for (char& c : w) c = (char)letter(rng);
+    }
+    return out;
+}
+
+// ==================== Graphs ====================
+struct EdgeList {
+    int vertices = 0;
+    std::vector<std::tuple<int, int, int>> edges;  // {from, to, weight}, directed
+};
+
+// side x side grid, 4-neighbour, both directions, weights in [1, 100]:
+// the usual stand-in for road networks (degree <= 4, diameter ~ 2 * side)
+inline EdgeList roadGraph(int vertices, uint64_t seed = 4) {
+    int side = std::max(2, (int)std::sqrt((double)vertices));
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> weight(1, 100);
+    EdgeList g;
+    g.vertices = side * side;
+    g.edges.reserve(4 * (size_t)g.vertices);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) {
+                int w = weight(rng);
+                g.edges.emplace_back(u, u + 1, w);
+                g.edges.emplace_back(u + 1, u, w);
+            }
+            if (r + 1 < side) {
+                int w = weight(rng);
+                g.edges.emplace_back(u, u + side, w);
+                g.edges.emplace_back(u + side, u, w);
+            }
+        }
+    }
+    return g;
+}
+
+// R-MAT (a, b, c, d) = (0.57, 0.19, 0.19, 0.05) as in Graph500, with
+// `vertices` rounded up to a power of two and an average out-degree of
+// `degree`; a ring keeps every vertex reachable from 0
+inline EdgeList socialGraph(int vertices, int degree = 16, uint64_t seed = 5) {
+    int scale = 1;
+    while ((1 << scale) < vertices) scale++;
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_int_distribution<int> weight(1, 100);
+    EdgeList g;
+    g.vertices = 1 << scale;
+    g.edges.reserve((size_t)g.vertices * degree);
+    for (int u = 0; u < g.vertices; u++) {
+        g.edges.emplace_back(u, (u + 1) % g.vertices, weight(rng));
+    }
+    for (long long e = g.vertices; e < (long long)g.vertices * degree; e++) {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double p = unit(rng);
+            int right = p >= 0.57 && p < 0.76 ? 1 : p >= 0.95;
+            int down = p >= 0.76;
+            u |= down << bit;
+            v |= right << bit;
+        }
+        g.edges.emplace_back(u, v, weight(rng));
+    }
+    return g;
+}
+
+enum GraphKind { ROAD = 0, SOCIAL = 1 };
+
+inline const char* graphName(int kind) { return kind == SOCIAL ? "social" : "road"; }
+
+inline EdgeList graph(int kind, int vertices) {
+    return kind == SOCIAL ? socialGraph(vertices) : roadGraph(vertices);
+}
+
+}  // namespace bench
+
+#endif  // DSA_BENCH_INPUTS_H
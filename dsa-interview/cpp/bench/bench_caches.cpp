@@ -0,0 +1,149 @@
+/**
+ * Cache Benchmarks: read-through traces (get, put on miss) over uniform and
+ * Zipfian keys. Args are {key universe, distribution}; every cache holds
+ * universe / 8 entries. Reports items/s and the hit ratio.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <optional>
+
+#include "LRUCache.h"
+#include "Inputs.h"
+
+namespace {
+
+constexpr size_t TRACE_LENGTH = 1 << 20;
+
+bool isHit(const int* value) { return value != nullptr; }
+bool isHit(int value) { return value != -1; }
+bool isHit(const std::optional<int>& value) { return value.has_value(); }
+
+template<typename Cache>
+bool access(Cache& cache, int key) {
+    bool hit = isHit(cache.get(key));
+    if (!hit) cache.put(key, key);
+    return hit;
+}
+
+template<typename Cache>
+void BM_Trace(benchmark::State& state) {
+    const int universe = state.range(0);
+    const std::vector<int> trace = bench::keys(TRACE_LENGTH, universe, state.range(1));
+    size_t hits = 0, accesses = 0;
+    for (auto _ : state) {
+        Cache cache(std::max(1, universe / 8));
+        for (int key : trace) hits += access(cache, key);
+        accesses += trace.size();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(accesses);
+    state.counters["hit_ratio"] = (double)hits / std::max<size_t>(accesses, 1);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+// Batch API: both caches prefetch their index PREFETCH_DISTANCE keys ahead
+// (bucket head nodes for LRUCache, home slots for SlabLRUCache)
+template<typename Cache>
+void BM_TraceBatched(benchmark::State& state) {
+    const int universe = state.range(0);
+    const std::vector<int> trace = bench::keys(TRACE_LENGTH, universe, state.range(1));
+    constexpr size_t BATCH = 64;
+    size_t hits = 0, accesses = 0;
+    for (auto _ : state) {
+        Cache cache(std::max(1, universe / 8));
+        std::vector<int> batch(BATCH);
+        std::vector<std::pair<int, int>> misses;
+        for (size_t i = 0; i + BATCH <= trace.size(); i += BATCH) {
+            std::copy(trace.begin() + i, trace.begin() + i + BATCH, batch.begin());
+            auto values = cache.getMany(batch);
+            misses.clear();
+            for (size_t j = 0; j < BATCH; j++) {
+                if (isHit(values[j])) hits++;
+                else misses.emplace_back(batch[j], batch[j]);
+            }
+            cache.putMany(misses);
+        }
+        accesses += trace.size() / BATCH * BATCH;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(accesses);
+    state.counters["hit_ratio"] = (double)hits / std::max<size_t>(accesses, 1);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+// Plain LRUCache behind one mutex: the baseline for the sharded cache
+class MutexLRUCache {
+private:
+    std::mutex mtx;
+    LRUCache<int, int> cache;
+
+public:
+    explicit MutexLRUCache(size_t capacity) : cache(capacity) {}
+
+    std::optional<int> get(int key) {
+        std::lock_guard<std::mutex> lock(mtx);
+        int* value = cache.get(key);
+        return value ? std::optional<int>(*value) : std::nullopt;
+    }
+
+    void put(int key, int value) {
+        std::lock_guard<std::mutex> lock(mtx);
+        cache.put(key, value);
+    }
+};
+
+// Every thread replays its own slice of one trace against a shared cache
+template<typename Cache>
+void BM_TraceThreaded(benchmark::State& state) {
+    static std::unique_ptr<Cache> cache;
+    static std::vector<int> trace;
+    const int universe = state.range(0);
+    if (state.thread_index() == 0) {
+        trace = bench::keys(TRACE_LENGTH, universe, state.range(1));
+        cache = std::make_unique<Cache>(std::max(1, universe / 8));
+    }
+    size_t hits = 0, accesses = 0;
+    for (auto _ : state) {
+        size_t slice = trace.size() / state.threads();
+        size_t begin = slice * state.thread_index();
+        for (size_t i = begin; i < begin + slice; i++) hits += access(*cache, trace[i]);
+        accesses += slice;
+    }
+    state.SetItemsProcessed(accesses);
+    state.counters["hit_ratio"] = benchmark::Counter((double)hits / std::max<size_t>(accesses, 1),
+                                                     benchmark::Counter::kAvgThreads);
+    state.SetLabel(bench::distributionName(state.range(1)));
+    if (state.thread_index() == 0) cache.reset();
+}
+
+void traceArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"keys", "dist"});
+    for (int keys : {1 << 12, 1 << 16, 1 << 20}) {
+        for (int dist : {bench::UNIFORM, bench::ZIPF}) b->Args({keys, dist});
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+void threadedArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"keys", "dist"})->Args({1 << 16, bench::ZIPF})->Args({1 << 20, bench::UNIFORM});
+    b->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Trace, LRUCache<int, int>)->Apply(traceArgs);
+BENCHMARK_TEMPLATE(BM_Trace, LFUCache<int, int>)->Apply(traceArgs);
+BENCHMARK_TEMPLATE(BM_Trace, ConstantLFUCache)->Apply(traceArgs);
+BENCHMARK_TEMPLATE(BM_Trace, TinyLFUCache)->Apply(traceArgs);
+BENCHMARK_TEMPLATE(BM_Trace, SlabLRUCache)->Apply(traceArgs);
+BENCHMARK_TEMPLATE(BM_Trace, ConcurrentLRUCache<int, int>)->Apply(traceArgs);
+
+BENCHMARK_TEMPLATE(BM_TraceBatched, LRUCache<int, int>)->Apply(traceArgs);
+BENCHMARK_TEMPLATE(BM_TraceBatched, SlabLRUCache)->Apply(traceArgs);
+
+BENCHMARK_TEMPLATE(BM_TraceThreaded, MutexLRUCache)->Apply(threadedArgs);
+BENCHMARK_TEMPLATE(BM_TraceThreaded, ConcurrentLRUCache<int, int>)->Apply(threadedArgs);
+
+BENCHMARK_MAIN();
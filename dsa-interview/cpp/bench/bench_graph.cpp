@@ -0,0 +1,165 @@
+/**
+ * Graph Benchmarks on road-like grids and R-MAT social graphs. Args are
+ * {vertices, kind} with kind 0 = road, 1 = social.
+ * - BFS: adjacency list vs CSR vs parallel direction-optimizing BFS
+ * - Dijkstra: {adjList, CSR} x {binary, 4-ary, radix} queue policies
+ * - MST: Prim vs Kruskal vs parallel Boruvka
+ * - All-pairs: Floyd-Warshall vs blocked Floyd-Warshall
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Graph.h"
+#include "Inputs.h"
+
+namespace {
+
+Graph toGraph(const bench::EdgeList& input) {
+    Graph g(input.vertices);
+    for (auto& [from, to, weight] : input.edges) g.addEdge(from, to, weight);
+    return g;
+}
+
+// Road edges are already listed both ways; social edges get a reverse copy
+Graph toUndirectedGraph(const bench::EdgeList& input, int kind) {
+    Graph g(input.vertices);
+    for (auto& [from, to, weight] : input.edges) {
+        if (kind == bench::ROAD && from > to) continue;
+        g.addUndirectedEdge(from, to, weight);
+    }
+    return g;
+}
+
+template<typename G>
+G buildGraph(const bench::EdgeList& input);
+
+template<>
+Graph buildGraph<Graph>(const bench::EdgeList& input) { return toGraph(input); }
+
+template<>
+CsrGraph buildGraph<CsrGraph>(const bench::EdgeList& input) { return CsrGraph(input.vertices, input.edges); }
+
+void label(benchmark::State& state, const bench::EdgeList& input) {
+    state.SetLabel(bench::graphName(state.range(1)));
+    state.counters["edges"] = input.edges.size();
+}
+
+template<typename G>
+void BM_BFS(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const G g = buildGraph<G>(input);
+    for (auto _ : state) benchmark::DoNotOptimize(g.bfs(0));
+    state.SetItemsProcessed(state.iterations() * input.edges.size());
+    label(state, input);
+}
+
+void BM_ParallelBFS(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const CsrGraph g(input.vertices, input.edges);
+    ThreadPool pool;
+    ParallelBfs bfs(g, pool);
+    for (auto _ : state) benchmark::DoNotOptimize(bfs.levels(0));
+    state.SetItemsProcessed(state.iterations() * input.edges.size());
+    label(state, input);
+}
+
+template<typename G, typename Queue>
+void BM_Dijkstra(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const G g = buildGraph<G>(input);
+    for (auto _ : state) benchmark::DoNotOptimize(g.template dijkstra<Queue>(0));
+    state.SetItemsProcessed(state.iterations() * input.edges.size());
+    label(state, input);
+}
+
+template<typename G>
+void BM_BellmanFord(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const G g = buildGraph<G>(input);
+    for (auto _ : state) benchmark::DoNotOptimize(g.bellmanFord(0));
+    label(state, input);
+}
+
+template<typename Run>
+void runMST(benchmark::State& state, Run run) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const Graph g = toUndirectedGraph(input, state.range(1));
+    long long total = 0;
+    for (auto _ : state) {
+        total = 0;
+        for (auto& [from, to, weight] : run(g)) total += weight;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * input.edges.size());
+    state.counters["weight"] = total;
+    label(state, input);
+}
+
+void BM_PrimMST(benchmark::State& state) {
+    runMST(state, [](const Graph& g) { return g.primMST(); });
+}
+
+void BM_KruskalMST(benchmark::State& state) {
+    runMST(state, [](const Graph& g) { return g.kruskalMST(); });
+}
+
+void BM_BoruvkaMST(benchmark::State& state) {
+    ThreadPool pool;
+    runMST(state, [&](const Graph& g) { return g.boruvkaMST(pool); });
+}
+
+void BM_FloydWarshall(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const Graph g = toGraph(input);
+    for (auto _ : state) benchmark::DoNotOptimize(g.floydWarshall());
+    label(state, input);
+}
+
+void BM_FloydWarshallBlocked(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const Graph g = toGraph(input);
+    ThreadPool pool;
+    for (auto _ : state) benchmark::DoNotOptimize(g.floydWarshallBlocked(&pool));
+    label(state, input);
+}
+
+void graphArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"V", "kind"});
+    for (int v : {1 << 14, 1 << 18, 1 << 20}) {
+        for (int kind : {bench::ROAD, bench::SOCIAL}) b->Args({v, kind});
+    }
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+void smallGraphArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"V", "kind"});
+    for (int v : {1 << 8, 1 << 10}) {
+        for (int kind : {bench::ROAD, bench::SOCIAL}) b->Args({v, kind});
+    }
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_BFS, Graph)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_BFS, CsrGraph)->Apply(graphArgs);
+BENCHMARK(BM_ParallelBFS)->Apply(graphArgs);
+
+BENCHMARK_TEMPLATE(BM_Dijkstra, Graph, BinaryHeapQueue)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Dijkstra, Graph, DaryHeapQueue<4>)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Dijkstra, Graph, RadixHeapQueue)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Dijkstra, CsrGraph, BinaryHeapQueue)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Dijkstra, CsrGraph, DaryHeapQueue<4>)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Dijkstra, CsrGraph, RadixHeapQueue)->Apply(graphArgs);
+
+BENCHMARK_TEMPLATE(BM_BellmanFord, Graph)->Apply(smallGraphArgs);
+BENCHMARK_TEMPLATE(BM_BellmanFord, CsrGraph)->Apply(smallGraphArgs);
+
+BENCHMARK(BM_PrimMST)->Apply(graphArgs);
+BENCHMARK(BM_KruskalMST)->Apply(graphArgs);
+BENCHMARK(BM_BoruvkaMST)->Apply(graphArgs);
+
+BENCHMARK(BM_FloydWarshall)->Apply(smallGraphArgs);
+BENCHMARK(BM_FloydWarshallBlocked)->Apply(smallGraphArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+/**
+ * Heap and Selection Benchmarks. Args are {n, distribution}: uniform values
+ * are mostly distinct, Zipfian values are heavily duplicated.
+ * - Push n, pop n: binary Heap vs DaryHeap<4/8> vs std::priority_queue
+ * - k-th element: nth_element vs Floyd-Rivest selectKth vs parallelSelectKth
+ * - Top-k frequent: heap vs partitioned parallel vs Space-Saving sketch
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <queue>
+
+#include "Heap.h"
+#include "Inputs.h"
+
+namespace {
+
+// Adapts std::priority_queue to the push/top/pop/empty shape of the others
+template<typename T>
+class StdHeap {
+private:
+    std::priority_queue<T, std::vector<T>, std::greater<T>> pq;
+
+public:
+    void push(const T& val) { pq.push(val); }
+    const T& top() const { return pq.top(); }
+    void pop() { pq.pop(); }
+    bool empty() const { return pq.empty(); }
+};
+
+template<typename HeapType>
+void BM_PushPop(benchmark::State& state) {
+    const int n = state.range(0);
+    const std::vector<int> values = bench::keys(n, n, state.range(1));
+    for (auto _ : state) {
+        HeapType heap;
+        for (int v : values) heap.push(v);
+        long long sum = 0;
+        while (!heap.empty()) {
+            sum += heap.top();
+            heap.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+template<typename Select>
+void runSelect(benchmark::State& state, Select select) {
+    const int n = state.range(0);
+    const std::vector<int> values = bench::keys(n, n, state.range(1));
+    std::vector<int> scratch;
+    for (auto _ : state) {
+        state.PauseTiming();
+        scratch = values;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(select(scratch, n / 2));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+void BM_NthElement(benchmark::State& state) {
+    runSelect(state, [](std::vector<int>& v, size_t k) {
+        std::nth_element(v.begin(), v.begin() + k, v.end());
+        return v[k];
+    });
+}
+
+void BM_SelectKth(benchmark::State& state) {
+    runSelect(state, [](std::vector<int>& v, size_t k) { return selectKth(v, k); });
+}
+
+void BM_ParallelSelectKth(benchmark::State& state) {
+    ThreadPool pool;
+    runSelect(state, [&](std::vector<int>& v, size_t k) { return parallelSelectKth(v, k, pool); });
+}
+
+void BM_SelectQuantiles(benchmark::State& state) {
+    const std::vector<double> qs = {0.5, 0.9, 0.99, 0.999};
+    runSelect(state, [&](std::vector<int>& v, size_t) { return selectQuantiles(v, qs).back(); });
+}
+
+void BM_TopKFrequent(benchmark::State& state) {
+    const int n = state.range(0);
+    std::vector<int> stream = bench::keys(n, n, state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(topKFrequent(stream, 100));
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+void BM_TopKFrequentParallel(benchmark::State& state) {
+    const int n = state.range(0);
+    const std::vector<int> stream = bench::keys(n, n, state.range(1));
+    ThreadPool pool;
+    for (auto _ : state) benchmark::DoNotOptimize(topKFrequentParallel(stream, 100, pool));
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+void BM_SpaceSaving(benchmark::State& state) {
+    const int n = state.range(0);
+    const std::vector<int> stream = bench::keys(n, n, state.range(1));
+    for (auto _ : state) {
+        SpaceSaving<int> sketch(1000);
+        for (int key : stream) sketch.offer(key);
+        benchmark::DoNotOptimize(sketch.topK(100));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+void sizeArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "dist"});
+    for (int n : {1 << 12, 1 << 16, 1 << 20}) {
+        for (int dist : {bench::UNIFORM, bench::ZIPF}) b->Args({n, dist});
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+void largeArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "dist"});
+    for (int n : {1 << 16, 1 << 20, 1 << 22}) {
+        for (int dist : {bench::UNIFORM, bench::ZIPF}) b->Args({n, dist});
+    }
+    b->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PushPop, StdHeap<int>)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_PushPop, Heap<int>)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_PushPop, DaryHeap<int, 4>)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_PushPop, DaryHeap<int, 8>)->Apply(sizeArgs);
+
+BENCHMARK(BM_NthElement)->Apply(largeArgs);
+BENCHMARK(BM_SelectKth)->Apply(largeArgs);
+BENCHMARK(BM_ParallelSelectKth)->Apply(largeArgs);
+BENCHMARK(BM_SelectQuantiles)->Apply(largeArgs);
+
+BENCHMARK(BM_TopKFrequent)->Apply(largeArgs);
+BENCHMARK(BM_TopKFrequentParallel)->Apply(largeArgs);
+BENCHMARK(BM_SpaceSaving)->Apply(largeArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,173 @@
+/**
+ * Range Tree Benchmarks. Args are {n, distribution}; values are uniform and
+ * the distribution shapes the query ranges (uniform lengths, or Zipfian
+ * short ranges). Each iteration answers QUERIES queries.
+ * - Range sum: SegmentTree vs MonoidSegmentTree vs BIT vs lazy trees, BIT batchQuery
+ * - Range min: MonoidSegmentTree vs SparseTable vs batchQuery
+ * - Range k-th: MergeSortTree vs WaveletMatrix
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "SegmentTree.h"
+#include "BinaryIndexedTree.h"
+#include "Inputs.h"
+
+namespace {
+
+constexpr size_t QUERIES = 1 << 16;
+
+struct Input {
+    std::vector<int> values;
+    std::vector<RangeQuery> queries;
+
+    explicit Input(const benchmark::State& state)
+        : values(bench::keys(state.range(0), 1 << 30, bench::UNIFORM)),
+          queries(bench::ranges(QUERIES, state.range(0), state.range(1))) {}
+};
+
+template<typename Query>
+void runQueries(benchmark::State& state, const Input& input, Query query) {
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto [l, r] : input.queries) sum += query(l, r);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * input.queries.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+std::vector<long long> widen(const std::vector<int>& values) {
+    return std::vector<long long>(values.begin(), values.end());
+}
+
+void BM_SumSegmentTree(benchmark::State& state) {
+    Input input(state);
+    SegmentTree<long long> tree(widen(input.values), 0, [](long long a, long long b) { return a + b; });
+    runQueries(state, input, [&](int l, int r) { return tree.query(l, r); });
+}
+
+void BM_SumMonoidSegmentTree(benchmark::State& state) {
+    Input input(state);
+    MonoidSegmentTree<long long, SumOp<long long>> tree(widen(input.values));
+    runQueries(state, input, [&](int l, int r) { return tree.query(l, r); });
+}
+
+void BM_SumBinaryIndexedTree(benchmark::State& state) {
+    Input input(state);
+    BinaryIndexedTree<long long> bit(widen(input.values));
+    runQueries(state, input, [&](int l, int r) { return bit.rangeSum(l, r); });
+}
+
+void BM_SumBinaryIndexedTreeBatch(benchmark::State& state) {
+    Input input(state);
+    BinaryIndexedTree<long long> bit(widen(input.values));
+    ThreadPool pool;
+    for (auto _ : state) benchmark::DoNotOptimize(batchQuery(bit, input.queries, &pool));
+    state.SetItemsProcessed(state.iterations() * input.queries.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+void BM_SumLazySegmentTree(benchmark::State& state) {
+    Input input(state);
+    LazySegmentTree tree(input.values);
+    runQueries(state, input, [&](int l, int r) { return tree.query(l, r); });
+}
+
+void BM_SumRangeAddSumTree(benchmark::State& state) {
+    Input input(state);
+    RangeAddSumTree<long long> tree(widen(input.values));
+    runQueries(state, input, [&](int l, int r) { return tree.query(l, r); });
+}
+
+// Alternating range add and range sum
+void BM_RangeAddLazySegmentTree(benchmark::State& state) {
+    Input input(state);
+    LazySegmentTree tree(input.values);
+    runQueries(state, input, [&](int l, int r) {
+        tree.rangeUpdate(l, r, 1);
+        return tree.query(l, r);
+    });
+}
+
+void BM_RangeAddRangeAddSumTree(benchmark::State& state) {
+    Input input(state);
+    RangeAddSumTree<long long> tree(widen(input.values));
+    runQueries(state, input, [&](int l, int r) {
+        tree.rangeApply(l, r, 1);
+        return tree.query(l, r);
+    });
+}
+
+void BM_RangeAddBinaryIndexedTree(benchmark::State& state) {
+    Input input(state);
+    RangeUpdateRangeQueryBIT<long long> bit(input.values.size());
+    for (size_t i = 0; i < input.values.size(); i++) bit.rangeAdd(i, i, input.values[i]);
+    runQueries(state, input, [&](int l, int r) {
+        bit.rangeAdd(l, r, 1);
+        return bit.rangeSum(l, r);
+    });
+}
+
+void BM_MinMonoidSegmentTree(benchmark::State& state) {
+    Input input(state);
+    MonoidSegmentTree<int, MinOp<int>> tree(input.values);
+    runQueries(state, input, [&](int l, int r) { return tree.query(l, r); });
+}
+
+void BM_MinSparseTable(benchmark::State& state) {
+    Input input(state);
+    SparseTable<int, MinOp<int>> table(input.values);
+    runQueries(state, input, [&](int l, int r) { return table.query(l, r); });
+}
+
+void BM_MinSparseTableBatch(benchmark::State& state) {
+    Input input(state);
+    SparseTable<int, MinOp<int>> table(input.values);
+    ThreadPool pool;
+    for (auto _ : state) benchmark::DoNotOptimize(batchQuery(table, input.queries, &pool));
+    state.SetItemsProcessed(state.iterations() * input.queries.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+void BM_KthMergeSortTree(benchmark::State& state) {
+    Input input(state);
+    MergeSortTree tree(input.values);
+    runQueries(state, input, [&](int l, int r) { return tree.kthSmallest(l, r, (r - l) / 2 + 1); });
+}
+
+void BM_KthWaveletMatrix(benchmark::State& state) {
+    Input input(state);
+    WaveletMatrix wavelet(input.values);
+    runQueries(state, input, [&](int l, int r) { return wavelet.kthSmallest(l, r, (r - l) / 2 + 1); });
+}
+
+void rangeArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "dist"});
+    for (int n : {1 << 12, 1 << 16, 1 << 20}) {
+        for (int dist : {bench::UNIFORM, bench::ZIPF}) b->Args({n, dist});
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SumSegmentTree)->Apply(rangeArgs);
+BENCHMARK(BM_SumMonoidSegmentTree)->Apply(rangeArgs);
+BENCHMARK(BM_SumBinaryIndexedTree)->Apply(rangeArgs);
+BENCHMARK(BM_SumBinaryIndexedTreeBatch)->Apply(rangeArgs)->UseRealTime();
+BENCHMARK(BM_SumLazySegmentTree)->Apply(rangeArgs);
+BENCHMARK(BM_SumRangeAddSumTree)->Apply(rangeArgs);
+
+BENCHMARK(BM_RangeAddLazySegmentTree)->Apply(rangeArgs);
+BENCHMARK(BM_RangeAddRangeAddSumTree)->Apply(rangeArgs);
+BENCHMARK(BM_RangeAddBinaryIndexedTree)->Apply(rangeArgs);
+
+BENCHMARK(BM_MinMonoidSegmentTree)->Apply(rangeArgs);
+BENCHMARK(BM_MinSparseTable)->Apply(rangeArgs);
+BENCHMARK(BM_MinSparseTableBatch)->Apply(rangeArgs)->UseRealTime();
+
+BENCHMARK(BM_KthMergeSortTree)->Apply(rangeArgs);
+BENCHMARK(BM_KthWaveletMatrix)->Apply(rangeArgs);
+
+BENCHMARK_MAIN();
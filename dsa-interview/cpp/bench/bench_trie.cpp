@@ -0,0 +1,173 @@
+/**
+ * Trie Benchmarks. Args are {words, distribution}: the dictionary is a set of
+ * random lowercase words and lookups draw from it uniformly or Zipfian.
+ * - Build and lookup: Trie vs CompactTrie vs DoubleArrayTrie vs RadixTrie
+ * - Autocomplete top-k by prefix
+ * - Max-XOR queries: pointer XORTrie vs FlatXORTrie (single and batched)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Trie.h"
+#include "Inputs.h"
+
+namespace {
+
+struct Dictionary {
+    std::vector<std::string> words;
+    std::vector<std::string> lookups;
+    std::vector<long long> popularity;  // Lookups per word
+
+    explicit Dictionary(const benchmark::State& state)
+        : words(bench::words(state.range(0))), popularity(words.size(), 0) {
+        for (int i : bench::keys(1 << 16, words.size(), state.range(1))) {
+            lookups.push_back(words[i]);
+            popularity[i]++;
+        }
+    }
+};
+
+// 30-bit XOR keys; Zipfian draws repeat hot keys, scattered over the key space
+std::vector<int> xorKeys(size_t count, int distribution, uint64_t seed = 1) {
+    std::vector<int> keys = bench::keys(count, std::max<int>(count, 2), distribution, seed);
+    for (int& k : keys) k = (int)((uint32_t)k * 2654435761u & ((1u << 30) - 1));
+    return keys;
+}
+
+template<typename T>
+T buildTrie(const std::vector<std::string>& words) {
+    T trie;
+    for (const std::string& w : words) trie.insert(w);
+    return trie;
+}
+
+template<>
+DoubleArrayTrie buildTrie<DoubleArrayTrie>(const std::vector<std::string>& words) {
+    return DoubleArrayTrie(buildTrie<CompactTrie>(words));
+}
+
+template<typename T>
+auto memoryBytes(const T& trie, int) -> decltype(trie.memoryBytes()) { return trie.memoryBytes(); }
+
+template<typename T>
+size_t memoryBytes(const T&, long) { return 0; }
+
+template<typename T>
+void BM_Build(benchmark::State& state) {
+    Dictionary dict(state);
+    for (auto _ : state) {
+        T trie = buildTrie<T>(dict.words);
+        benchmark::DoNotOptimize(trie);
+    }
+    state.SetItemsProcessed(state.iterations() * dict.words.size());
+    state.counters["bytes"] = memoryBytes(buildTrie<T>(dict.words), 0);
+}
+
+template<typename T>
+void BM_Search(benchmark::State& state) {
+    Dictionary dict(state);
+    T trie = buildTrie<T>(dict.words);
+    for (auto _ : state) {
+        int found = 0;
+        for (const std::string& w : dict.lookups) found += trie.search(w);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * dict.lookups.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+    state.counters["bytes"] = memoryBytes(trie, 0);
+}
+
+template<typename T>
+void BM_CountPrefix(benchmark::State& state) {
+    Dictionary dict(state);
+    T trie = buildTrie<T>(dict.words);
+    for (auto _ : state) {
+        long long total = 0;
+        for (const std::string& w : dict.lookups) total += trie.countWordsWithPrefix(w.substr(0, 2));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * dict.lookups.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+// Weights follow the lookup popularity, so hot prefixes have hot completions
+void BM_AutocompleteTopK(benchmark::State& state) {
+    Dictionary dict(state);
+    AutocompleteTrie trie(10);
+    for (size_t i = 0; i < dict.words.size(); i++) trie.insert(dict.words[i], dict.popularity[i]);
+    for (auto _ : state) {
+        size_t total = 0;
+        for (const std::string& w : dict.lookups) total += trie.topK(std::string_view(w).substr(0, 2), 10).size();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * dict.lookups.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+}
+
+template<typename T>
+void BM_MaxXOR(benchmark::State& state) {
+    const std::vector<int> keys = xorKeys(state.range(0), state.range(1));
+    const std::vector<int> queries = xorKeys(1 << 16, bench::UNIFORM, 7);
+    T trie;
+    for (int k : keys) trie.insert(k);
+    for (auto _ : state) {
+        long long total = 0;
+        for (int q : queries) total += trie.getMaxXOR(q);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * queries.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+    state.counters["bytes"] = memoryBytes(trie, 0);
+}
+
+void BM_MaxXORBatched(benchmark::State& state) {
+    const std::vector<int> keys = xorKeys(state.range(0), state.range(1));
+    const std::vector<int> queries = xorKeys(1 << 16, bench::UNIFORM, 7);
+    std::vector<uint32_t> sorted(keys.begin(), keys.end());
+    std::sort(sorted.begin(), sorted.end());
+    FlatXORTrie<uint32_t> trie(sorted);
+    const std::vector<uint32_t> batch(queries.begin(), queries.end());
+    for (auto _ : state) benchmark::DoNotOptimize(trie.getMaxXOR(batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+    state.SetLabel(bench::distributionName(state.range(1)));
+    state.counters["bytes"] = trie.memoryBytes();
+}
+
+void dictionaryArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"words", "dist"});
+    for (int n : {1 << 10, 1 << 14, 1 << 18}) {
+        for (int dist : {bench::UNIFORM, bench::ZIPF}) b->Args({n, dist});
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+void buildArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"words", "dist"});
+    for (int n : {1 << 10, 1 << 14, 1 << 18}) b->Args({n, bench::UNIFORM});
+    b->Unit(benchmark::kMicrosecond);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Build, Trie)->Apply(buildArgs);
+BENCHMARK_TEMPLATE(BM_Build, CompactTrie)->Apply(buildArgs);
+BENCHMARK_TEMPLATE(BM_Build, DoubleArrayTrie)->Apply(buildArgs);
+BENCHMARK_TEMPLATE(BM_Build, RadixTrie)->Apply(buildArgs);
+
+BENCHMARK_TEMPLATE(BM_Search, Trie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_Search, CompactTrie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_Search, DoubleArrayTrie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_Search, RadixTrie)->Apply(dictionaryArgs);
+
+BENCHMARK_TEMPLATE(BM_CountPrefix, Trie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_CountPrefix, CompactTrie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_CountPrefix, DoubleArrayTrie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_CountPrefix, RadixTrie)->Apply(dictionaryArgs);
+
+BENCHMARK(BM_AutocompleteTopK)->Apply(dictionaryArgs);
+
+BENCHMARK_TEMPLATE(BM_MaxXOR, XORTrie)->Apply(dictionaryArgs);
+BENCHMARK_TEMPLATE(BM_MaxXOR, FlatXORTrie<uint32_t>)->Apply(dictionaryArgs);
+BENCHMARK(BM_MaxXORBatched)->Apply(dictionaryArgs)->UseRealTime();
+
+BENCHMARK_MAIN();
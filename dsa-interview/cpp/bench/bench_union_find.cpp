@@ -0,0 +1,93 @@
+/**
+ * Union-Find Benchmarks on the edge lists of road-like grids and R-MAT social
+ * graphs. Args are {vertices, kind} with kind 0 = road, 1 = social.
+ * - Sequential UnionFind vs ConcurrentUnionFind driven by one thread
+ * - connectedComponents: ConcurrentUnionFind from every pool thread
+ * - find-heavy workload: connected() queries after the unions
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "UnionFind.h"
+#include "Inputs.h"
+
+namespace {
+
+std::vector<std::pair<int, int>> edgePairs(const bench::EdgeList& input) {
+    std::vector<std::pair<int, int>> pairs;
+    pairs.reserve(input.edges.size());
+    for (auto& [from, to, weight] : input.edges) pairs.emplace_back(from, to);
+    // Shuffled so unions don't arrive in the generator's locality-friendly order
+    std::shuffle(pairs.begin(), pairs.end(), std::mt19937_64(6));
+    return pairs;
+}
+
+template<typename UF>
+void BM_Unite(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const std::vector<std::pair<int, int>> pairs = edgePairs(input);
+    for (auto _ : state) {
+        UF uf(input.vertices);
+        int merged = 0;
+        for (auto [u, v] : pairs) merged += uf.unite(u, v);
+        benchmark::DoNotOptimize(merged);
+    }
+    state.SetItemsProcessed(state.iterations() * pairs.size());
+    state.SetLabel(bench::graphName(state.range(1)));
+}
+
+template<typename UF>
+void BM_Connected(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const std::vector<std::pair<int, int>> pairs = edgePairs(input);
+    const std::vector<int> probes = bench::keys(1 << 18, input.vertices, bench::UNIFORM);
+    UF uf(input.vertices);
+    for (auto [u, v] : pairs) uf.unite(u, v);
+    for (auto _ : state) {
+        int same = 0;
+        for (size_t i = 0; i + 1 < probes.size(); i += 2) same += uf.connected(probes[i], probes[i + 1]);
+        benchmark::DoNotOptimize(same);
+    }
+    state.SetItemsProcessed(state.iterations() * probes.size() / 2);
+    state.SetLabel(bench::graphName(state.range(1)));
+}
+
+void BM_ConnectedComponents(benchmark::State& state) {
+    const bench::EdgeList input = bench::graph(state.range(1), state.range(0));
+    const std::vector<std::pair<int, int>> pairs = edgePairs(input);
+    ThreadPool pool(state.range(2));
+    int count = 0;
+    for (auto _ : state) {
+        count = connectedComponents(input.vertices, pairs, pool).count;
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * pairs.size());
+    state.SetLabel(bench::graphName(state.range(1)));
+    state.counters["components"] = count;
+}
+
+void graphArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"V", "kind"});
+    for (int v : {1 << 14, 1 << 18, 1 << 20}) {
+        for (int kind : {bench::ROAD, bench::SOCIAL}) b->Args({v, kind});
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+void threadArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"V", "kind", "threads"});
+    for (int kind : {bench::ROAD, bench::SOCIAL}) {
+        for (int threads : {1, 2, 4, 8}) b->Args({1 << 20, kind, threads});
+    }
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Unite, UnionFind)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Unite, ConcurrentUnionFind)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Connected, UnionFind)->Apply(graphArgs);
+BENCHMARK_TEMPLATE(BM_Connected, ConcurrentUnionFind)->Apply(graphArgs);
+BENCHMARK(BM_ConnectedComponents)->Apply(threadArgs);
+
+BENCHMARK_MAIN();